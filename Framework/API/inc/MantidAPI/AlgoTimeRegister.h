@@ -7,7 +7,11 @@
 #ifndef MANTID_API_ALGOTIMEREGISTER_H_
 #define MANTID_API_ALGOTIMEREGISTER_H_
 
+#include <atomic>
+#include <chrono>
+#include <list>
 #include <mutex>
+#include <string>
 #include <thread>
 #include <vector>
 
@@ -19,7 +23,16 @@ namespace Mantid {
 namespace Instrumentation {
 
 /** AlgoTimeRegister : simple class to dump information about executed
- * algorithms
+ * algorithms.
+ *
+ * Every thread records into its own ring buffer, so registering an execution
+ * does not take a lock. A buffer keeps the most recent records of its thread
+ * up to the size given to the constructor. Executions started while another
+ * one is running on the same thread (child algorithms, or any scope timed
+ * with a Dump) are recorded with their nesting depth. On destruction the
+ * register writes algotimeregister.out and the same information in the
+ * Chrome trace event format to algotimeregister.json, which chrome://tracing
+ * or Perfetto can open.
  */
 class AlgoTimeRegister {
 public:
@@ -28,30 +41,60 @@ public:
   struct Info {
     std::string m_name;
     std::thread::id m_threadId;
+    size_t m_depth;
     timespec m_begin;
     timespec m_end;
 
-    Info(const std::string &nm, const std::thread::id &id, const timespec &be,
-         const timespec &en)
-        : m_name(nm), m_threadId(id), m_begin(be), m_end(en) {}
+    Info(const std::string &nm, const std::thread::id &id, size_t depth,
+         const timespec &be, const timespec &en)
+        : m_name(nm), m_threadId(id), m_depth(depth), m_begin(be), m_end(en) {
+    }
   };
 
   class Dump {
     AlgoTimeRegister &m_algoTimeRegister;
     timespec m_regStart;
     const std::string m_name;
+    size_t m_depth;
 
   public:
     Dump(AlgoTimeRegister &atr, const std::string &nm);
     ~Dump();
   };
 
-  AlgoTimeRegister();
+  explicit AlgoTimeRegister(size_t bufferSize = 1 << 16);
   ~AlgoTimeRegister();
+  AlgoTimeRegister(const AlgoTimeRegister &) = delete;
+  AlgoTimeRegister &operator=(const AlgoTimeRegister &) = delete;
+
+  std::vector<std::vector<Info>> threadRecords() const;
 
 private:
-  std::mutex m_mutex;
-  std::vector<Info> m_info;
+  /// The records of one thread, overwriting the oldest once it is full
+  class ThreadBuffer {
+  public:
+    void add(Info &&info, size_t capacity);
+    std::vector<Info> records() const;
+
+  private:
+    std::vector<Info> m_records;
+    /// the position of the oldest record once the buffer is full
+    size_t m_oldest = 0;
+  };
+
+  ThreadBuffer &threadInfo();
+  void writeText(const std::string &filename) const;
+  void writeChromeTrace(const std::string &filename) const;
+
+  /// the maximum number of records kept for each thread
+  const size_t m_bufferSize;
+  /// identifies this register to the threads, even if a later register is
+  /// created at the same address
+  const size_t m_generation;
+  /// protects the list of per-thread buffers
+  mutable std::mutex m_mutex;
+  /// one buffer of records per thread which has registered an execution
+  std::list<ThreadBuffer> m_threadInfo;
   timespec m_hstart;
   std::chrono::high_resolution_clock::time_point m_start;
 };
@@ -59,4 +102,4 @@ private:
 } // namespace Instrumentation
 } // namespace Mantid
 
-#endif /* MANTID_API_ALGOTIMEREGISTER_H_ */
\ No newline at end of file
+#endif /* MANTID_API_ALGOTIMEREGISTER_H_ */
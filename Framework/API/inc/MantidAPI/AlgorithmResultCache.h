@@ -0,0 +1,56 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2019 ISIS Rutherford Appleton Laboratory UKRI,
+//     NScD Oak Ridge National Laboratory, European Spallation Source
+//     & Institut Laue - Langevin
+// SPDX - License - Identifier: GPL - 3.0 +
+#ifndef MANTID_API_ALGORITHMRESULTCACHE_H_
+#define MANTID_API_ALGORITHMRESULTCACHE_H_
+
+#include "MantidAPI/DllConfig.h"
+#include <string>
+
+namespace Mantid {
+namespace API {
+class Algorithm;
+
+/** AlgorithmResultCache : An opt-in on-disk cache of the output workspaces of
+  algorithms, so that repeating an execution with the same inputs reads its
+  outputs instead of running it again.
+
+  The cache is enabled by setting algorithms.resultcache.directory and listing
+  the algorithms to cache in algorithms.resultcache.algorithms. An execution is
+  identified by the version of Mantid, the name and version of the algorithm,
+  its property values, the size and modification time of the files it loads
+  and a checksum of the content of its input workspaces. Only matrix
+  workspaces can be checksummed, so executions with other input workspaces are
+  not cached. Outputs are stored with SaveNexusProcessed, so only algorithms
+  whose outputs are all workspaces it can save are cached.
+*/
+class MANTID_API_DLL AlgorithmResultCache {
+public:
+  explicit AlgorithmResultCache(Algorithm &alg);
+
+  static bool isEnabled(const std::string &algorithmName);
+
+  /// The key of the execution, or an empty string if it cannot be cached
+  const std::string &key() const { return m_key; }
+  bool load();
+  void save();
+
+private:
+  std::string createKey() const;
+  std::string outputFilename(const std::string &propertyName) const;
+
+  /// The algorithm about to be executed
+  Algorithm &m_alg;
+  /// The directory the results are stored in
+  std::string m_directory;
+  /// The key of the execution
+  std::string m_key;
+};
+
+} // namespace API
+} // namespace Mantid
+
+#endif /* MANTID_API_ALGORITHMRESULTCACHE_H_ */
@@ -93,6 +93,15 @@ protected:
   MatrixWorkspace_sptr minus(const MatrixWorkspace_sptr lhs,
                              const double &rhsValue);
 
+  /// Add a configured child algorithm to the steps run by executeChildSteps
+  size_t addChildStep(boost::shared_ptr<Algorithm> alg);
+  /// Pass an output workspace of one step to an input of a later step
+  void connectChildSteps(const size_t fromStep,
+                         const std::string &outputProperty, const size_t toStep,
+                         const std::string &inputProperty);
+  /// Run the added steps, running independent steps concurrently
+  void executeChildSteps();
+
 private:
   template <typename LHSType, typename RHSType, typename ResultType>
   ResultType executeBinaryAlgorithm(const std::string &algorithmName,
@@ -128,6 +137,18 @@ private:
   /// Map property names to names in supplied properties manager
   std::map<std::string, std::string> m_nameToPMName;
 
+  /// An output workspace of one child step used as an input of another
+  struct ChildStepLink {
+    size_t fromStep;
+    std::string outputProperty;
+    size_t toStep;
+    std::string inputProperty;
+  };
+  /// The child algorithms added with addChildStep
+  std::vector<boost::shared_ptr<Algorithm>> m_childSteps;
+  /// The connections between the child steps
+  std::vector<ChildStepLink> m_childStepLinks;
+
   // This method is a workaround for the C4661 compiler warning in visual
   // studio. This allows the template declaration and definition to be separated
   // in different files. See stack overflow article for a more detailed
@@ -0,0 +1,49 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2019 ISIS Rutherford Appleton Laboratory UKRI,
+//     NScD Oak Ridge National Laboratory, European Spallation Source
+//     & Institut Laue - Langevin
+// SPDX - License - Identifier: GPL - 3.0 +
+#ifndef MANTID_API_SPECTRUMGEOMETRY_H_
+#define MANTID_API_SPECTRUMGEOMETRY_H_
+
+#include <limits>
+#include <vector>
+
+namespace Mantid {
+namespace API {
+
+/** SpectrumGeometry holds the geometry of all spectra of a workspace with one
+  array per quantity, as returned by SpectrumInfo::geometry(). Loops over all
+  spectra can read the values they need contiguously instead of querying
+  SpectrumInfo for each spectrum.
+
+  Values that are not defined are NaN: all values of spectra without
+  detectors, and the scattering angles of spectra that include monitors.
+*/
+struct SpectrumGeometry {
+  explicit SpectrumGeometry(const size_t size = 0)
+      : l2(size, std::numeric_limits<double>::quiet_NaN()), twoTheta(l2),
+        signedTwoTheta(l2), azimuthal(l2), directionX(l2), directionY(l2),
+        directionZ(l2) {}
+
+  /// The number of spectra
+  size_t size() const { return l2.size(); }
+
+  /// Distance from the sample, as SpectrumInfo::l2()
+  std::vector<double> l2;
+  /// Scattering angle in radians, as SpectrumInfo::twoTheta()
+  std::vector<double> twoTheta;
+  /// Signed scattering angle in radians, as SpectrumInfo::signedTwoTheta()
+  std::vector<double> signedTwoTheta;
+  /// Azimuthal angle in radians of the position of the spectrum about the Z
+  /// axis, as IDetector::getPhi()
+  std::vector<double> azimuthal;
+  /// Components of the unit vector from the sample to the spectrum
+  std::vector<double> directionX, directionY, directionZ;
+};
+
+} // namespace API
+} // namespace Mantid
+
+#endif /* MANTID_API_SPECTRUMGEOMETRY_H_ */
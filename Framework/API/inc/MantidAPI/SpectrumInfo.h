@@ -8,6 +8,7 @@
 #define MANTID_API_SPECTRUMINFO_H_
 
 #include "MantidAPI/DllConfig.h"
+#include "MantidAPI/SpectrumGeometry.h"
 #include "MantidAPI/SpectrumInfoIterator.h"
 #include "MantidKernel/V3D.h"
 #include "MantidKernel/cow_ptr.h"
@@ -71,6 +72,8 @@ public:
   bool hasDetectors(const size_t index) const;
   bool hasUniqueDetector(const size_t index) const;
 
+  SpectrumGeometry geometry() const;
+
   void setMasked(const size_t index, bool masked);
 
   // This is likely to be deprecated/removed with the introduction of
@@ -1,13 +1,39 @@
 #include "MantidAPI/AlgoTimeRegister.h"
 #include "MantidKernel/MultiThreaded.h"
 #include <fstream>
+#include <map>
 #include <time.h>
 
 namespace Mantid {
 namespace Instrumentation {
 
+namespace {
+/// the nesting depth of the timed scopes running on this thread
+thread_local size_t g_depth = 0;
+
+/// the number of registers created so far
+std::atomic<size_t> g_generations(0);
+
+/// @return the time elapsed since the register started, in nanoseconds
+std::size_t toNanoseconds(const timespec &t) {
+  return std::size_t(t.tv_sec * 1000000000) + t.tv_nsec;
+}
+
+/// @return the string with the characters JSON needs escaped escaped
+std::string escapeJSON(const std::string &text) {
+  std::string escaped;
+  escaped.reserve(text.size());
+  for (auto c : text) {
+    if (c == '"' || c == '\\')
+      escaped += '\\';
+    escaped += c;
+  }
+  return escaped;
+}
+} // namespace
+
 AlgoTimeRegister::Dump::Dump(AlgoTimeRegister &atr, const std::string &nm)
-    : m_algoTimeRegister(atr), m_name(nm) {
+    : m_algoTimeRegister(atr), m_name(nm), m_depth(g_depth++) {
   clock_gettime(CLOCK_MONOTONIC, &m_regStart);
 }
 
@@ -26,34 +52,118 @@ timespec AlgoTimeRegister::diff(timespec start, timespec end) {
 AlgoTimeRegister::Dump::~Dump() {
   timespec regFinish;
   clock_gettime(CLOCK_MONOTONIC, &regFinish);
-  {
-    std::lock_guard<std::mutex> lock(m_algoTimeRegister.m_mutex);
-    m_algoTimeRegister.m_info.emplace_back(m_name, std::this_thread::get_id(),
-                                           m_regStart, regFinish);
+  --g_depth;
+  m_algoTimeRegister.threadInfo().add(
+      Info(m_name, std::this_thread::get_id(), m_depth, m_regStart, regFinish),
+      m_algoTimeRegister.m_bufferSize);
+}
+
+/** Add a record, replacing the oldest one if the buffer holds capacity
+ * records already */
+void AlgoTimeRegister::ThreadBuffer::add(Info &&info, size_t capacity) {
+  if (m_records.size() < capacity) {
+    m_records.emplace_back(std::move(info));
+  } else if (capacity > 0) {
+    m_records[m_oldest] = std::move(info);
+    m_oldest = (m_oldest + 1) % capacity;
   }
 }
 
-AlgoTimeRegister::AlgoTimeRegister()
-    : m_start(std::chrono::high_resolution_clock::now()) {
+/// @return the records of the buffer, oldest first
+std::vector<AlgoTimeRegister::Info>
+AlgoTimeRegister::ThreadBuffer::records() const {
+  std::vector<Info> ordered(m_records.cbegin() + m_oldest, m_records.cend());
+  ordered.insert(ordered.end(), m_records.cbegin(),
+                 m_records.cbegin() + m_oldest);
+  return ordered;
+}
+
+/** Constructor
+ * @param bufferSize :: the maximum number of records kept for each thread
+ */
+AlgoTimeRegister::AlgoTimeRegister(size_t bufferSize)
+    : m_bufferSize(bufferSize), m_generation(++g_generations),
+      m_start(std::chrono::high_resolution_clock::now()) {
   clock_gettime(CLOCK_MONOTONIC, &m_hstart);
 }
 
-AlgoTimeRegister::~AlgoTimeRegister() {
+/** @return the buffer of records for the calling thread. The lock is only
+ * taken the first time a thread registers with this register. */
+AlgoTimeRegister::ThreadBuffer &AlgoTimeRegister::threadInfo() {
+  thread_local size_t owner = 0;
+  thread_local ThreadBuffer *buffer = nullptr;
+  if (owner != m_generation) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_threadInfo.emplace_back();
+    buffer = &m_threadInfo.back();
+    owner = m_generation;
+  }
+  return *buffer;
+}
+
+/** @return the records of every thread which has registered an execution,
+ * oldest first. Call it when no timed scope is running, as the threads add
+ * records without a lock. */
+std::vector<std::vector<AlgoTimeRegister::Info>>
+AlgoTimeRegister::threadRecords() const {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  std::vector<std::vector<Info>> records;
+  records.reserve(m_threadInfo.size());
+  for (const auto &buffer : m_threadInfo)
+    records.emplace_back(buffer.records());
+  return records;
+}
+
+/// Write the records in the plain text format
+void AlgoTimeRegister::writeText(const std::string &filename) const {
   std::fstream fs;
-  fs.open("./algotimeregister.out", std::ios::out);
+  fs.open(filename, std::ios::out);
   fs << "START_POINT: "
      << std::chrono::duration_cast<std::chrono::nanoseconds>(
             m_start.time_since_epoch())
             .count()
      << " MAX_THREAD: " << PARALLEL_GET_MAX_THREADS << "\n";
-  for (auto &elem : m_info) {
-    auto st = diff(m_hstart, elem.m_begin);
-    auto fi = diff(m_hstart, elem.m_end);
-    fs << "ThreadID=" << elem.m_threadId << ", AlgorithmName=" << elem.m_name
-       << ", StartTime=" << std::size_t(st.tv_sec * 1000000000) + st.tv_nsec
-       << ", EndTime=" << std::size_t(fi.tv_sec * 1000000000) + fi.tv_nsec
-       << "\n";
+  for (const auto &info : threadRecords()) {
+    for (const auto &elem : info) {
+      auto st = diff(m_hstart, elem.m_begin);
+      auto fi = diff(m_hstart, elem.m_end);
+      fs << "ThreadID=" << elem.m_threadId << ", AlgorithmName=" << elem.m_name
+         << ", StartTime=" << toNanoseconds(st)
+         << ", EndTime=" << toNanoseconds(fi) << "\n";
+    }
+  }
+}
+
+/** Write the records as complete events of the Chrome trace event format.
+ * Threads are numbered in the order they first registered an execution. */
+void AlgoTimeRegister::writeChromeTrace(const std::string &filename) const {
+  std::fstream fs;
+  fs.open(filename, std::ios::out);
+  fs << "{\"traceEvents\":[";
+  bool first = true;
+  size_t tid = 0;
+  for (const auto &info : threadRecords()) {
+    for (const auto &elem : info) {
+      const auto st = toNanoseconds(diff(m_hstart, elem.m_begin));
+      const auto fi = toNanoseconds(diff(m_hstart, elem.m_end));
+      if (!first)
+        fs << ",";
+      first = false;
+      // timestamps and durations are in microseconds
+      fs << "\n{\"name\":\"" << escapeJSON(elem.m_name)
+         << "\",\"cat\":\"algorithm\",\"ph\":\"X\",\"pid\":0,\"tid\":" << tid
+         << ",\"ts\":" << static_cast<double>(st) * 1e-3
+         << ",\"dur\":" << static_cast<double>(fi - st) * 1e-3
+         << ",\"args\":{\"depth\":" << elem.m_depth << "}}";
+    }
+    ++tid;
   }
+  fs << "\n],\"displayTimeUnit\":\"ms\"}\n";
+}
+
+AlgoTimeRegister::~AlgoTimeRegister() {
+  writeText("./algotimeregister.out");
+  writeChromeTrace("./algotimeregister.json");
 }
 
 } // namespace Instrumentation
@@ -9,6 +9,7 @@
 #include "MantidAPI/AlgorithmHistory.h"
 #include "MantidAPI/AlgorithmManager.h"
 #include "MantidAPI/AlgorithmProxy.h"
+#include "MantidAPI/AlgorithmResultCache.h"
 #include "MantidAPI/AnalysisDataService.h"
 #include "MantidAPI/DeprecatedAlgorithm.h"
 #include "MantidAPI/IWorkspaceProperty.h"
@@ -624,8 +625,17 @@ bool Algorithm::executeInternal() {
       }
 
       startTime = Mantid::Types::Core::DateAndTime::getCurrentTime();
-      // Call the concrete algorithm's exec method
-      this->exec(executionMode);
+      // Call the concrete algorithm's exec method, unless its outputs can be
+      // read from the result cache
+      if (!AlgorithmResultCache::isEnabled(name())) {
+        this->exec(executionMode);
+      } else {
+        AlgorithmResultCache resultCache(*this);
+        if (!resultCache.load()) {
+          this->exec(executionMode);
+          resultCache.save();
+        }
+      }
       registerFeatureUsage();
       // Check for a cancellation request in case the concrete algorithm doesn't
       interruption_point();
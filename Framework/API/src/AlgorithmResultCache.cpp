@@ -0,0 +1,403 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2019 ISIS Rutherford Appleton Laboratory UKRI,
+//     NScD Oak Ridge National Laboratory, European Spallation Source
+//     & Institut Laue - Langevin
+// SPDX - License - Identifier: GPL - 3.0 +
+#include "MantidAPI/AlgorithmResultCache.h"
+#include "MantidAPI/Algorithm.h"
+#include "MantidAPI/AlgorithmManager.h"
+#include "MantidAPI/Axis.h"
+#include "MantidAPI/FileProperty.h"
+#include "MantidAPI/IEventWorkspace.h"
+#include "MantidAPI/IWorkspaceProperty.h"
+#include "MantidAPI/MatrixWorkspace.h"
+#include "MantidAPI/MultipleFileProperty.h"
+#include "MantidAPI/Run.h"
+#include "MantidAPI/Sample.h"
+#include "MantidAPI/WorkspaceGroup.h"
+#include "MantidAPI/WorkspaceHistory.h"
+#include "MantidGeometry/Instrument.h"
+#include "MantidGeometry/Instrument/DetectorInfo.h"
+#include "MantidGeometry/Instrument/ParameterMap.h"
+#include "MantidGeometry/Objects/CSGObject.h"
+#include "MantidKernel/ChecksumHelper.h"
+#include "MantidKernel/ConfigObserver.h"
+#include "MantidKernel/ConfigService.h"
+#include "MantidKernel/Logger.h"
+#include "MantidKernel/MantidVersion.h"
+#include "MantidKernel/Material.h"
+#include "MantidKernel/StringTokenizer.h"
+#include "MantidKernel/Unit.h"
+
+#include <Poco/File.h>
+#include <Poco/Path.h>
+#include <Poco/SHA1Engine.h>
+#include <Poco/TemporaryFile.h>
+
+#include <boost/make_shared.hpp>
+
+#include <algorithm>
+#include <sstream>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+using namespace Mantid::Kernel;
+
+namespace Mantid {
+namespace API {
+namespace {
+/// static logger
+Logger g_log("AlgorithmResultCache");
+
+/// Add a string to a digest, terminated so that consecutive strings differ
+void updateString(Poco::DigestEngine &digest, const std::string &str) {
+  digest.update(str);
+  digest.update('\0');
+}
+
+/// Add an array of values to a digest
+template <typename T>
+void updateValues(Poco::DigestEngine &digest, const std::vector<T> &values) {
+  const auto size = values.size();
+  digest.update(&size, sizeof(size));
+  if (!values.empty())
+    digest.update(values.data(), values.size() * sizeof(T));
+}
+
+/// Add the events of a spectrum to a digest
+void updateEvents(Poco::DigestEngine &digest, const IEventList &events) {
+  const auto type = events.getEventType();
+  digest.update(&type, sizeof(type));
+  updateValues(digest, events.getTofs());
+  updateValues(digest, events.getWeights());
+  updateValues(digest, events.getWeightErrors());
+  const auto pulseTimes = events.getPulseTimes();
+  std::vector<int64_t> nanoseconds(pulseTimes.size());
+  std::transform(pulseTimes.cbegin(), pulseTimes.cend(), nanoseconds.begin(),
+                 [](const Types::Core::DateAndTime &time) {
+                   return time.totalNanoseconds();
+                 });
+  updateValues(digest, nanoseconds);
+}
+
+/// Add the instrument, run and sample of a workspace to a digest
+void updateExperimentInfo(Poco::DigestEngine &digest,
+                          const MatrixWorkspace &ws) {
+  updateString(digest, ws.getInstrument()->getName());
+  const auto &detectorInfo = ws.detectorInfo();
+  std::vector<double> detectors;
+  detectors.reserve(8 * detectorInfo.size());
+  for (size_t i = 0; i < detectorInfo.size(); ++i) {
+    const auto position = detectorInfo.position(i);
+    const auto rotation = detectorInfo.rotation(i);
+    detectors.insert(detectors.end(),
+                     {position.X(), position.Y(), position.Z(), rotation.real(),
+                      rotation.imagI(), rotation.imagJ(), rotation.imagK(),
+                      detectorInfo.isMasked(i) ? 1.0 : 0.0});
+  }
+  updateValues(digest, detectors);
+  updateString(digest, ws.constInstrumentParameters().asString());
+
+  for (const auto prop : ws.run().getProperties()) {
+    updateString(digest, prop->name());
+    updateString(digest, prop->value());
+  }
+
+  const auto &sample = ws.sample();
+  updateString(digest, sample.getName());
+  updateString(digest, sample.getMaterial().name());
+  const double sampleValues[] = {sample.getMaterial().numberDensity(),
+                                 sample.getThickness(), sample.getHeight(),
+                                 sample.getWidth()};
+  digest.update(sampleValues, sizeof(sampleValues));
+  const auto &shape = sample.getShape();
+  updateString(digest, shape.id());
+  if (const auto csgShape = dynamic_cast<const Geometry::CSGObject *>(&shape))
+    updateString(digest, csgShape->getShapeXML());
+}
+
+/**
+ * Create a checksum of the content of an input workspace: its data, the
+ * mapping of its spectra, its instrument, run and sample.
+ * @return the checksum, or an empty string if the content cannot be read
+ */
+std::string contentChecksum(const Workspace &workspace) {
+  const auto ws = dynamic_cast<const MatrixWorkspace *>(&workspace);
+  // Rebinned outputs hold fractional areas that are not exposed here
+  if (!ws || ws->id() == "RebinnedOutput")
+    return "";
+  const auto eventWS = dynamic_cast<const IEventWorkspace *>(ws);
+
+  Poco::SHA1Engine digest;
+  updateString(digest, ws->id());
+  updateString(digest, ws->getAxis(0)->unit()->unitID());
+  updateString(digest, ws->YUnit());
+  digest.update(ws->isDistribution() ? '1' : '0');
+  const auto nhist = ws->getNumberHistograms();
+  digest.update(&nhist, sizeof(nhist));
+  for (size_t i = 0; i < nhist; ++i) {
+    const auto &spectrum = ws->getSpectrum(i);
+    const auto spectrumNo = spectrum.getSpectrumNo();
+    digest.update(&spectrumNo, sizeof(spectrumNo));
+    const auto &detIDs = spectrum.getDetectorIDs();
+    updateValues(digest, std::vector<detid_t>(detIDs.cbegin(), detIDs.cend()));
+    updateValues(digest, ws->x(i).rawData());
+    if (eventWS) {
+      updateEvents(digest, eventWS->getSpectrum(i));
+    } else {
+      updateValues(digest, ws->y(i).rawData());
+      updateValues(digest, ws->e(i).rawData());
+    }
+    if (ws->hasDx(i))
+      updateValues(digest, ws->dx(i).rawData());
+  }
+  updateExperimentInfo(digest, *ws);
+  return Poco::DigestEngine::digestToHex(digest.digest());
+}
+
+/// Describe the version of a file on disk
+void appendFileInfo(std::ostream &description, const std::string &filename) {
+  Poco::File file(filename);
+  if (file.exists() && file.isFile())
+    description << "[" << file.getSize() << ","
+                << file.getLastModified().epochMicroseconds() << "]";
+}
+
+const std::string DIRECTORY_KEY = "algorithms.resultcache.directory";
+const std::string ALGORITHMS_KEY = "algorithms.resultcache.algorithms";
+
+/// The configuration of the cache
+struct CacheSettings {
+  std::string directory;
+  std::unordered_set<std::string> algorithms;
+};
+
+/**
+ * Holds the configuration of the cache, read once rather than on every
+ * execution of every algorithm, and updated when the configuration changes.
+ */
+class CacheSettingsObserver : public ConfigObserver {
+public:
+  CacheSettingsObserver() { reload(); }
+  boost::shared_ptr<const CacheSettings> settings() const {
+    return boost::atomic_load(&m_settings);
+  }
+
+protected:
+  void onValueChanged(const std::string &name, const std::string &,
+                      const std::string &) override {
+    if (name == DIRECTORY_KEY || name == ALGORITHMS_KEY)
+      reload();
+  }
+
+private:
+  void reload() {
+    auto &config = ConfigService::Instance();
+    auto settings = boost::make_shared<CacheSettings>();
+    settings->directory = config.getString(DIRECTORY_KEY);
+    StringTokenizer tokens(config.getString(ALGORITHMS_KEY), ",;",
+                           StringTokenizer::TOK_TRIM |
+                               StringTokenizer::TOK_IGNORE_EMPTY);
+    settings->algorithms.insert(tokens.cbegin(), tokens.cend());
+    if (settings->directory.empty())
+      settings->algorithms.clear();
+    boost::atomic_store(&m_settings,
+                        boost::shared_ptr<const CacheSettings>(settings));
+  }
+
+  boost::shared_ptr<const CacheSettings> m_settings;
+};
+
+/// @return the current configuration of the cache
+boost::shared_ptr<const CacheSettings> cacheSettings() {
+  // Never deleted, so that it does not outlive the ConfigService at exit
+  static const auto observer = new CacheSettingsObserver();
+  return observer->settings();
+}
+
+/// @return true if the property is an output workspace property
+bool isOutputWorkspace(const Property *prop) {
+  return prop->direction() == Direction::Output &&
+         dynamic_cast<const IWorkspaceProperty *>(prop);
+}
+} // namespace
+
+/**
+ * Check whether the execution of the algorithm can be cached and create its
+ * key. Its properties must all be set.
+ * @param alg :: the algorithm about to be executed
+ */
+AlgorithmResultCache::AlgorithmResultCache(Algorithm &alg) : m_alg(alg) {
+  const auto settings = cacheSettings();
+  m_directory = settings->directory;
+  if (settings->algorithms.count(m_alg.name()) > 0)
+    m_key = createKey();
+}
+
+/**
+ * Check whether the cache is used for an algorithm, without reading the
+ * configuration.
+ * @param algorithmName :: the name of the algorithm
+ * @return true if the outputs of the algorithm are cached
+ */
+bool AlgorithmResultCache::isEnabled(const std::string &algorithmName) {
+  const auto settings = cacheSettings();
+  return settings->algorithms.count(algorithmName) > 0;
+}
+
+/**
+ * Set the outputs of the algorithm from the cache.
+ * @return true if all outputs were read from the cache, in which case the
+ * algorithm does not need to be executed
+ */
+bool AlgorithmResultCache::load() {
+  if (m_key.empty())
+    return false;
+  const auto &props = m_alg.getProperties();
+  const bool allCached =
+      std::all_of(props.cbegin(), props.cend(), [this](const Property *prop) {
+        return !isOutputWorkspace(prop) ||
+               Poco::File(outputFilename(prop->name())).exists();
+      });
+  if (!allCached)
+    return false;
+
+  std::vector<std::pair<std::string, Workspace_sptr>> outputs;
+  try {
+    for (const auto prop : props) {
+      if (!isOutputWorkspace(prop))
+        continue;
+      auto loader =
+          AlgorithmManager::Instance().createUnmanaged("LoadNexusProcessed");
+      loader->initialize();
+      loader->setChild(true);
+      loader->setLogging(false);
+      loader->setPropertyValue("Filename", outputFilename(prop->name()));
+      loader->setPropertyValue("OutputWorkspace", "__result_cache");
+      loader->execute();
+      Workspace_sptr ws = loader->getProperty("OutputWorkspace");
+      // the history is filled in again as if the algorithm had run
+      ws->history().clearHistory();
+      outputs.emplace_back(prop->name(), ws);
+    }
+  } catch (std::exception &ex) {
+    g_log.warning() << "Could not read the outputs of " << m_alg.name()
+                    << " from the result cache: " << ex.what() << "\n";
+    return false;
+  }
+
+  for (const auto &output : outputs)
+    m_alg.setProperty(output.first, output.second);
+  g_log.information() << "Read the outputs of " << m_alg.name()
+                      << " from the result cache\n";
+  return true;
+}
+
+/**
+ * Store the outputs of the executed algorithm in the cache. Nothing is stored
+ * unless all outputs are workspaces which are not groups.
+ */
+void AlgorithmResultCache::save() {
+  if (m_key.empty())
+    return;
+  std::vector<std::pair<std::string, Workspace_sptr>> outputs;
+  for (const auto prop : m_alg.getProperties()) {
+    if (!isOutputWorkspace(prop))
+      continue;
+    auto ws = dynamic_cast<IWorkspaceProperty *>(prop)->getWorkspace();
+    if (!ws || boost::dynamic_pointer_cast<WorkspaceGroup>(ws))
+      return;
+    outputs.emplace_back(prop->name(), ws);
+  }
+
+  std::string tempFilename;
+  try {
+    Poco::File(m_directory).createDirectories();
+    for (const auto &output : outputs) {
+      const auto filename = outputFilename(output.first);
+      // Write to a temporary file, unique to this process, first so that
+      // other processes sharing the cache never read an incomplete file
+      tempFilename = Poco::TemporaryFile::tempName(m_directory) + ".nxs";
+      auto saver =
+          AlgorithmManager::Instance().createUnmanaged("SaveNexusProcessed");
+      saver->initialize();
+      saver->setChild(true);
+      saver->setLogging(false);
+      saver->setProperty("InputWorkspace", output.second);
+      saver->setPropertyValue("Filename", tempFilename);
+      saver->execute();
+      Poco::File(tempFilename).renameTo(filename);
+      tempFilename.clear();
+    }
+  } catch (std::exception &ex) {
+    g_log.warning() << "Could not store the outputs of " << m_alg.name()
+                    << " in the result cache: " << ex.what() << "\n";
+    if (!tempFilename.empty() && Poco::File(tempFilename).exists())
+      Poco::File(tempFilename).remove();
+  }
+}
+
+/**
+ * Create the key identifying the execution.
+ * @return the key, or an empty string if the execution cannot be cached
+ */
+std::string AlgorithmResultCache::createKey() const {
+  std::ostringstream description;
+  // Outputs of other releases may differ if the algorithm has changed
+  description << "Mantid " << MantidVersion::version() << " "
+              << MantidVersion::revisionFull() << "\n";
+  description << m_alg.name() << " v" << m_alg.version() << "\n";
+  for (const auto prop : m_alg.getProperties()) {
+    const auto wsProp = dynamic_cast<const IWorkspaceProperty *>(prop);
+    if (prop->direction() == Direction::InOut)
+      return "";
+    if (prop->direction() == Direction::Output) {
+      // Only output workspaces can be restored from the cache
+      if (!wsProp)
+        return "";
+      continue;
+    }
+
+    description << prop->name() << "=";
+    if (wsProp) {
+      // An input workspace is identified by its content, so that changes
+      // which are not recorded in its history are taken into account
+      if (const auto ws = wsProp->getWorkspace()) {
+        const auto checksum = contentChecksum(*ws);
+        if (checksum.empty())
+          return "";
+        description << checksum;
+      }
+    } else {
+      description << prop->value();
+      if (const auto fileProp = dynamic_cast<const FileProperty *>(prop)) {
+        if (fileProp->isLoadProperty())
+          appendFileInfo(description, prop->value());
+      } else if (const auto multiFileProp =
+                     dynamic_cast<const MultipleFileProperty *>(prop)) {
+        for (const auto &files : (*multiFileProp)())
+          for (const auto &file : files)
+            appendFileInfo(description, file);
+      }
+    }
+    description << "\n";
+  }
+  return ChecksumHelper::sha1FromString(description.str());
+}
+
+/**
+ * @param propertyName :: the name of an output workspace property
+ * @return the path of the file caching the output
+ */
+std::string AlgorithmResultCache::outputFilename(
+    const std::string &propertyName) const {
+  Poco::Path path(m_directory);
+  path.makeDirectory();
+  path.setFileName(m_alg.name() + "_" + m_key + "_" + propertyName + ".nxs");
+  return path.toString();
+}
+
+} // namespace API
+} // namespace Mantid
@@ -5,6 +5,7 @@
 //     & Institut Laue - Langevin
 // SPDX - License - Identifier: GPL - 3.0 +
 #include "MantidAPI/DataProcessorAlgorithm.h"
+#include "MantidAPI/AlgorithmHistory.h"
 #include "MantidAPI/AlgorithmManager.h"
 #include "MantidAPI/AlgorithmProperty.h"
 #include "MantidAPI/AnalysisDataService.h"
@@ -14,10 +15,13 @@
 #include "MantidAPI/WorkspaceFactory.h"
 #include "MantidKernel/Exception.h"
 #include "MantidKernel/FacilityInfo.h"
+#include "MantidKernel/FunctionTask.h"
 #include "MantidKernel/PropertyManager.h"
 #include "MantidKernel/PropertyManagerDataService.h"
 #include "MantidKernel/System.h"
+#include "MantidKernel/ThreadPool.h"
 #include "Poco/Path.h"
+#include <algorithm>
 #include <stdexcept>
 #ifdef MPI_BUILD
 #include <boost/mpi.hpp>
@@ -582,6 +586,118 @@ GenericDataProcessorAlgorithm<Base>::createWorkspaceSingleValue(
   return retVal;
 }
 
+/**
+ * Add a child algorithm to the steps run by executeChildSteps. The algorithm
+ * should be created with createChildAlgorithm and have all its properties
+ * set, apart from inputs that are connected to the outputs of other steps.
+ * @param alg :: the child algorithm of the step
+ * @return the index of the step
+ */
+template <class Base>
+size_t GenericDataProcessorAlgorithm<Base>::addChildStep(
+    boost::shared_ptr<Algorithm> alg) {
+  if (!alg)
+    throw std::invalid_argument("Cannot add an empty child step");
+  m_childSteps.emplace_back(std::move(alg));
+  return m_childSteps.size() - 1;
+}
+
+/**
+ * Pass the workspace of an output property of one step to an input property
+ * of another, which is then not run before the first one has finished. An
+ * output may be connected to the inputs of any number of steps.
+ * @param fromStep :: the index of the step producing the workspace
+ * @param outputProperty :: the name of its output workspace property
+ * @param toStep :: the index of the step using the workspace
+ * @param inputProperty :: the name of its input workspace property
+ */
+template <class Base>
+void GenericDataProcessorAlgorithm<Base>::connectChildSteps(
+    const size_t fromStep, const std::string &outputProperty,
+    const size_t toStep, const std::string &inputProperty) {
+  if (fromStep >= m_childSteps.size() || toStep >= m_childSteps.size())
+    throw std::out_of_range("Cannot connect a child step that was not added");
+  if (fromStep == toStep)
+    throw std::invalid_argument("Cannot connect a child step to itself");
+  m_childStepLinks.push_back({fromStep, outputProperty, toStep, inputProperty});
+}
+
+/**
+ * Execute the steps added with addChildStep. Each round runs every step whose
+ * connected inputs have been produced, concurrently when there is more than
+ * one, so independent branches of a workflow overlap. The steps and their
+ * connections are cleared afterwards. When the history of child algorithms is
+ * recorded, the steps of a concurrent round record into their own histories,
+ * which are then added in the order the steps were added. The child history is
+ * therefore ordered by round and then by step, whichever step finishes first.
+ * @throws std::runtime_error if a step fails or the steps depend on each other
+ * in a cycle
+ */
+template <class Base>
+void GenericDataProcessorAlgorithm<Base>::executeChildSteps() {
+  auto steps = std::move(m_childSteps);
+  auto links = std::move(m_childStepLinks);
+  m_childSteps.clear();
+  m_childStepLinks.clear();
+
+  std::vector<bool> done(steps.size(), false);
+  size_t numDone = 0;
+  while (numDone < steps.size()) {
+    std::vector<size_t> ready;
+    for (size_t step = 0; step < steps.size(); ++step) {
+      if (done[step])
+        continue;
+      const bool inputsReady =
+          std::none_of(links.cbegin(), links.cend(),
+                       [&done, step](const ChildStepLink &link) {
+                         return link.toStep == step && !done[link.fromStep];
+                       });
+      if (inputsReady)
+        ready.push_back(step);
+    }
+    if (ready.empty())
+      throw std::runtime_error("The child steps depend on each other in a "
+                               "cycle and cannot be executed");
+
+    for (const auto &link : links) {
+      if (!done[link.toStep] && done[link.fromStep]) {
+        Workspace_sptr ws =
+            steps[link.fromStep]->getProperty(link.outputProperty);
+        steps[link.toStep]->setProperty(link.inputProperty, ws);
+      }
+    }
+
+    if (ready.size() == 1) {
+      steps[ready.front()]->executeAsChildAlg();
+    } else {
+      const size_t numThreads =
+          std::min(ready.size(), ThreadPool::getNumPhysicalCores());
+      const bool recordHistory =
+          this->isRecordingHistoryForChild() && Base::m_history;
+      std::vector<boost::shared_ptr<AlgorithmHistory>> histories;
+      if (recordHistory) {
+        for (const auto step : ready) {
+          histories.emplace_back(boost::make_shared<AlgorithmHistory>(
+              steps[step]->name(), steps[step]->version(), ""));
+          steps[step]->trackAlgorithmHistory(histories.back());
+        }
+      }
+      ThreadPool pool(new ThreadSchedulerFIFO(), numThreads);
+      for (const auto step : ready)
+        pool.schedule(std::make_shared<FunctionTask>(
+            boost::bind(&Algorithm::executeAsChildAlg, steps[step].get())));
+      pool.joinAll();
+      for (const auto &history : histories)
+        for (const auto &child : history->getChildHistories())
+          Base::m_history->addChildHistory(child);
+    }
+
+    for (const auto step : ready)
+      done[step] = true;
+    numDone += ready.size();
+  }
+}
+
 template <typename T>
 void GenericDataProcessorAlgorithm<T>::visualStudioC4661Workaround() {}
 
@@ -8,14 +8,17 @@
 #include "MantidAPI/ExperimentInfo.h"
 #include "MantidAPI/SpectrumInfoIterator.h"
 #include "MantidBeamline/SpectrumInfo.h"
+#include "MantidGeometry/Instrument.h"
 #include "MantidGeometry/Instrument/DetectorGroup.h"
 #include "MantidGeometry/Instrument/DetectorInfo.h"
+#include "MantidGeometry/Instrument/ReferenceFrame.h"
 #include "MantidKernel/Exception.h"
 #include "MantidKernel/MultiThreaded.h"
 #include "MantidTypes/SpectrumDefinition.h"
 
 #include <algorithm>
 #include <boost/make_shared.hpp>
+#include <cmath>
 
 namespace Mantid {
 namespace API {
@@ -121,6 +124,82 @@ bool SpectrumInfo::hasUniqueDetector(const size_t index) const {
   return spectrumDefinition(index).size() == 1;
 }
 
+/** Returns the geometry of all spectra, calculated in one parallel loop.
+ *
+ * The values are those of l2(), twoTheta(), signedTwoTheta() and the
+ * azimuthal angle and direction of position(). Where those would throw, i.e.
+ * for spectra without detectors and for the scattering angles of spectra that
+ * include monitors, the values are NaN. The result is a copy and is not
+ * updated if the instrument changes later.
+ */
+SpectrumGeometry SpectrumInfo::geometry() const {
+  SpectrumGeometry geometry(size());
+  if (size() == 0)
+    return geometry;
+  // Bring all spectrum definitions up to date before reading them in parallel
+  const auto &spectrumDefinitions = *sharedSpectrumDefinitions();
+  const auto samplePos = samplePosition();
+  const auto sourcePos = sourcePosition();
+  const double l1 = this->l1();
+  const auto beamLine = samplePos - sourcePos;
+  const bool hasBeamLine = !beamLine.nullVector();
+  Kernel::V3D normToSurface;
+  if (hasBeamLine) {
+    const auto &instrumentUpAxis = m_experimentInfo.getInstrument()
+                                       ->getReferenceFrame()
+                                       ->vecThetaSign();
+    normToSurface = beamLine.cross_prod(instrumentUpAxis);
+  }
+
+  const auto numberOfSpectra = static_cast<int64_t>(size());
+  PARALLEL_FOR_NO_WSP_CHECK()
+  for (int64_t i = 0; i < numberOfSpectra; ++i) {
+    const auto &spectrumDefinition = spectrumDefinitions[i];
+    if (spectrumDefinition.size() == 0)
+      continue;
+    double l2{0.0}, twoTheta{0.0}, signedTwoTheta{0.0};
+    bool hasAngles{hasBeamLine};
+    Kernel::V3D position;
+    for (const auto &index : spectrumDefinition) {
+      const auto detectorPos = m_detectorInfo.position(index);
+      position += detectorPos;
+      if (m_detectorInfo.isMonitor(index)) {
+        hasAngles = false;
+        l2 += detectorPos.distance(sourcePos) - l1;
+        continue;
+      }
+      const auto sampleDetVec = detectorPos - samplePos;
+      const double distance = sampleDetVec.norm();
+      l2 += distance;
+      if (hasAngles && distance > 0.0) {
+        const double angle = sampleDetVec.angle(beamLine);
+        const auto cross = beamLine.cross_prod(sampleDetVec);
+        twoTheta += angle;
+        signedTwoTheta += normToSurface.scalar_prod(cross) < 0 ? -angle : angle;
+      } else {
+        hasAngles = false;
+      }
+    }
+
+    const auto count = static_cast<double>(spectrumDefinition.size());
+    geometry.l2[i] = l2 / count;
+    if (hasAngles) {
+      geometry.twoTheta[i] = twoTheta / count;
+      geometry.signedTwoTheta[i] = signedTwoTheta / count;
+    }
+    position /= count;
+    geometry.azimuthal[i] = std::atan2(position.Y(), position.X());
+    const auto direction = position - samplePos;
+    const double distance = direction.norm();
+    if (distance > 0.0) {
+      geometry.directionX[i] = direction.X() / distance;
+      geometry.directionY[i] = direction.Y() / distance;
+      geometry.directionZ[i] = direction.Z() / distance;
+    }
+  }
+  return geometry;
+}
+
 /** Set the mask flag of the spectrum with given index. Not thread safe.
  *
  * Currently this simply sets the mask flags for the underlying detectors. */
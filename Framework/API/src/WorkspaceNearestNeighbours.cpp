@@ -12,6 +12,7 @@
 // Nearest neighbours library
 #include "MantidKernel/ANN/ANN.h"
 #include "MantidKernel/Exception.h"
+#include "MantidKernel/MultiThreaded.h"
 #include "MantidKernel/Timer.h"
 
 namespace Mantid {
@@ -156,25 +157,29 @@ void WorkspaceNearestNeighbours::build(const int noNeighbours) {
   }
 
   auto annTree = std::make_unique<ANNkd_tree>(dataPoints, nspectra, 3);
-  pointNo = 0;
-  // Run the nearest neighbour search on each detector, reusing the arrays
-  // Set size initially to avoid array index error when testing in debug mode
-  std::vector<ANNidx> nnIndexList(m_noNeighbours);
-  std::vector<ANNdist> nnDistList(m_noNeighbours);
+  // Run the nearest neighbour search on each detector in parallel, the
+  // results of point i are stored from i * m_noNeighbours onwards
+  const auto nResults = static_cast<size_t>(nspectra) * m_noNeighbours;
+  std::vector<ANNidx> nnIndexList(nResults);
+  std::vector<ANNdist> nnDistList(nResults);
+  PARALLEL_FOR_NO_WSP_CHECK()
+  for (int i = 0; i < nspectra; ++i) {
+    const auto offset = static_cast<size_t>(i) * m_noNeighbours;
+    // An error bound of zero gives the exact nearest neighbours
+    annTree->annkSearch(dataPoints[i], m_noNeighbours, &nnIndexList[offset],
+                        &nnDistList[offset], 0.0);
+  }
 
+  // The boost graph is not thread safe so the edges are added afterwards
+  pointNo = 0;
   for (const auto idx : indices) {
     ANNpoint scaledPos = dataPoints[pointNo];
-    annTree->annkSearch(scaledPos,      // Point to search nearest neighbours of
-                        m_noNeighbours, // Number of neighbours to find (8)
-                        nnIndexList.data(), // Index list of results
-                        nnDistList.data(), // List of distances to each of these
-                        0.0 // Error bound (?) is this the radius to search in?
-    );
     // The distances that are returned are in our scaled coordinate
     // system. We store the real space ones.
     const V3D realPos = V3D(scaledPos[0], scaledPos[1], scaledPos[2]) * m_scale;
+    const auto offset = static_cast<size_t>(pointNo) * m_noNeighbours;
     for (int i = 0; i < m_noNeighbours; i++) {
-      ANNidx index = nnIndexList[i];
+      ANNidx index = nnIndexList[offset + i];
       V3D neighbour = V3D(dataPoints[index][0], dataPoints[index][1],
                           dataPoints[index][2]) *
                       m_scale;
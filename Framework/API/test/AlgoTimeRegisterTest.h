@@ -0,0 +1,111 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2018 ISIS Rutherford Appleton Laboratory UKRI,
+//     NScD Oak Ridge National Laboratory, European Spallation Source
+//     & Institut Laue - Langevin
+// SPDX - License - Identifier: GPL - 3.0 +
+#ifndef MANTID_API_ALGOTIMEREGISTERTEST_H_
+#define MANTID_API_ALGOTIMEREGISTERTEST_H_
+
+#include <cxxtest/TestSuite.h>
+
+#include "MantidAPI/AlgoTimeRegister.h"
+
+#include <cstdio>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+using Mantid::Instrumentation::AlgoTimeRegister;
+
+class AlgoTimeRegisterTest : public CxxTest::TestSuite {
+public:
+  // This pair of boilerplate methods prevent the suite being created statically
+  // This means the constructor isn't called when running other tests
+  static AlgoTimeRegisterTest *createSuite() {
+    return new AlgoTimeRegisterTest();
+  }
+  static void destroySuite(AlgoTimeRegisterTest *suite) { delete suite; }
+
+  // the registers write their records to the working directory when deleted
+  void tearDown() override {
+    std::remove("./algotimeregister.out");
+    std::remove("./algotimeregister.json");
+  }
+
+  void test_nested_scopes_record_their_depth() {
+    AlgoTimeRegister timeRegister;
+    {
+      AlgoTimeRegister::Dump outer(timeRegister, "Outer");
+      AlgoTimeRegister::Dump inner(timeRegister, "Inner");
+    }
+    const auto records = timeRegister.threadRecords();
+    TS_ASSERT_EQUALS(records.size(), 1);
+    TS_ASSERT_EQUALS(records[0].size(), 2);
+    TS_ASSERT_EQUALS(records[0][0].m_name, "Inner");
+    TS_ASSERT_EQUALS(records[0][0].m_depth, 1);
+    TS_ASSERT_EQUALS(records[0][1].m_name, "Outer");
+    TS_ASSERT_EQUALS(records[0][1].m_depth, 0);
+  }
+
+  void test_buffer_keeps_only_the_latest_records() {
+    AlgoTimeRegister timeRegister(4);
+    for (int i = 0; i < 10; ++i) {
+      AlgoTimeRegister::Dump dump(timeRegister, "Scope" + std::to_string(i));
+    }
+    const auto records = timeRegister.threadRecords();
+    TS_ASSERT_EQUALS(records.size(), 1);
+    TS_ASSERT_EQUALS(records[0].size(), 4);
+    for (size_t i = 0; i < records[0].size(); ++i) {
+      TS_ASSERT_EQUALS(records[0][i].m_name, "Scope" + std::to_string(i + 6));
+    }
+  }
+
+  void test_concurrent_registration() {
+    const size_t nThreads = 4;
+    const size_t nScopes = 100;
+    AlgoTimeRegister timeRegister(nScopes / 2);
+    std::vector<std::thread> threads;
+    for (size_t t = 0; t < nThreads; ++t) {
+      threads.emplace_back([&timeRegister, nScopes]() {
+        for (size_t i = 0; i < nScopes; ++i) {
+          AlgoTimeRegister::Dump dump(timeRegister, std::to_string(i));
+        }
+      });
+    }
+    for (auto &thread : threads)
+      thread.join();
+
+    const auto records = timeRegister.threadRecords();
+    TS_ASSERT_EQUALS(records.size(), nThreads);
+    for (const auto &threadRecords : records) {
+      TS_ASSERT_EQUALS(threadRecords.size(), nScopes / 2);
+      for (size_t i = 0; i < threadRecords.size(); ++i) {
+        TS_ASSERT_EQUALS(threadRecords[i].m_threadId,
+                         threadRecords.front().m_threadId);
+        TS_ASSERT_EQUALS(threadRecords[i].m_name,
+                         std::to_string(i + nScopes / 2));
+      }
+    }
+  }
+
+  void test_new_register_at_the_same_address_gets_its_own_buffer() {
+    std::aligned_storage<sizeof(AlgoTimeRegister),
+                         alignof(AlgoTimeRegister)>::type storage;
+    auto first = new (&storage) AlgoTimeRegister(10);
+    { AlgoTimeRegister::Dump dump(*first, "First"); }
+    first->~AlgoTimeRegister();
+
+    auto second = new (&storage) AlgoTimeRegister(10);
+    TS_ASSERT_EQUALS(static_cast<void *>(first), static_cast<void *>(second));
+    { AlgoTimeRegister::Dump dump(*second, "Second"); }
+    const auto records = second->threadRecords();
+    TS_ASSERT_EQUALS(records.size(), 1);
+    TS_ASSERT_EQUALS(records[0].size(), 1);
+    TS_ASSERT_EQUALS(records[0][0].m_name, "Second");
+    second->~AlgoTimeRegister();
+  }
+};
+
+#endif /* MANTID_API_ALGOTIMEREGISTERTEST_H_ */
@@ -0,0 +1,184 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2019 ISIS Rutherford Appleton Laboratory UKRI,
+//     NScD Oak Ridge National Laboratory, European Spallation Source
+//     & Institut Laue - Langevin
+// SPDX - License - Identifier: GPL - 3.0 +
+#ifndef MANTID_API_ALGORITHMRESULTCACHETEST_H_
+#define MANTID_API_ALGORITHMRESULTCACHETEST_H_
+
+#include <cxxtest/TestSuite.h>
+
+#include "MantidAPI/Algorithm.h"
+#include "MantidAPI/AlgorithmResultCache.h"
+#include "MantidAPI/WorkspaceProperty.h"
+#include "MantidKernel/ConfigService.h"
+#include "MantidTestHelpers/FakeObjects.h"
+
+#include <Poco/File.h>
+#include <Poco/Path.h>
+
+using Mantid::API::Algorithm;
+using Mantid::API::AlgorithmResultCache;
+using Mantid::API::MatrixWorkspace;
+using Mantid::API::MatrixWorkspace_sptr;
+using Mantid::API::PropertyMode;
+using Mantid::API::WorkspaceProperty;
+using Mantid::Kernel::ConfigService;
+using Mantid::Kernel::Direction;
+
+namespace {
+class CachedAlgorithm : public Algorithm {
+public:
+  const std::string name() const override { return "CachedAlgorithm"; }
+  int version() const override { return 1; }
+  const std::string category() const override { return "Test"; }
+  const std::string summary() const override { return "Test"; }
+
+  void init() override {
+    declareProperty("Value", 1);
+    declareProperty(std::make_unique<WorkspaceProperty<MatrixWorkspace>>(
+        "InputWorkspace", "", Direction::Input, PropertyMode::Optional));
+    declareProperty(std::make_unique<WorkspaceProperty<MatrixWorkspace>>(
+        "OutputWorkspace", "", Direction::Output));
+  }
+  void exec() override {}
+};
+
+class AlgorithmWithValueOutput : public CachedAlgorithm {
+public:
+  void init() override {
+    CachedAlgorithm::init();
+    declareProperty("Result", 0.0, Direction::Output);
+  }
+};
+
+boost::shared_ptr<WorkspaceTester> workspaceWithValue(const double value) {
+  auto ws = boost::make_shared<WorkspaceTester>();
+  ws->initialize(2, 4, 3);
+  for (size_t i = 0; i < ws->getNumberHistograms(); ++i)
+    ws->mutableY(i) = value;
+  return ws;
+}
+} // namespace
+
+class AlgorithmResultCacheTest : public CxxTest::TestSuite {
+public:
+  // This pair of boilerplate methods prevent the suite being created statically
+  // This means the constructor isn't called when running other tests
+  static AlgorithmResultCacheTest *createSuite() {
+    return new AlgorithmResultCacheTest();
+  }
+  static void destroySuite(AlgorithmResultCacheTest *suite) { delete suite; }
+
+  AlgorithmResultCacheTest()
+      : m_directory(Poco::Path::temp() + "AlgorithmResultCacheTest") {}
+
+  void setUp() override {
+    auto &config = ConfigService::Instance();
+    config.setString("algorithms.resultcache.directory", m_directory);
+    config.setString("algorithms.resultcache.algorithms",
+                     "Rebin, CachedAlgorithm");
+  }
+
+  void tearDown() override {
+    auto &config = ConfigService::Instance();
+    config.setString("algorithms.resultcache.directory", "");
+    config.setString("algorithms.resultcache.algorithms", "");
+    Poco::File directory(m_directory);
+    if (directory.exists())
+      directory.remove(true);
+  }
+
+  void test_cache_is_disabled_without_directory() {
+    ConfigService::Instance().setString("algorithms.resultcache.directory", "");
+    CachedAlgorithm alg;
+    alg.initialize();
+    AlgorithmResultCache cache(alg);
+    TS_ASSERT(cache.key().empty());
+    TS_ASSERT(!cache.load());
+  }
+
+  void test_only_listed_algorithms_are_cached() {
+    ConfigService::Instance().setString("algorithms.resultcache.algorithms",
+                                        "Rebin");
+    CachedAlgorithm alg;
+    alg.initialize();
+    TS_ASSERT(AlgorithmResultCache(alg).key().empty());
+  }
+
+  void test_isEnabled_follows_configuration() {
+    TS_ASSERT(AlgorithmResultCache::isEnabled("CachedAlgorithm"));
+    TS_ASSERT(AlgorithmResultCache::isEnabled("Rebin"));
+    TS_ASSERT(!AlgorithmResultCache::isEnabled("Scale"));
+    ConfigService::Instance().setString("algorithms.resultcache.directory", "");
+    TS_ASSERT(!AlgorithmResultCache::isEnabled("CachedAlgorithm"));
+  }
+
+  void test_key_depends_on_property_values() {
+    CachedAlgorithm alg;
+    alg.initialize();
+    alg.setPropertyValue("OutputWorkspace", "a");
+    const auto key = AlgorithmResultCache(alg).key();
+    TS_ASSERT(!key.empty());
+
+    // the names of output workspaces do not matter
+    alg.setPropertyValue("OutputWorkspace", "b");
+    TS_ASSERT_EQUALS(AlgorithmResultCache(alg).key(), key);
+
+    alg.setProperty("Value", 2);
+    TS_ASSERT_DIFFERS(AlgorithmResultCache(alg).key(), key);
+  }
+
+  void test_key_depends_on_content_of_input_workspaces() {
+    CachedAlgorithm alg;
+    alg.initialize();
+    alg.setProperty<MatrixWorkspace_sptr>("InputWorkspace",
+                                          workspaceWithValue(1.0));
+    const auto key = AlgorithmResultCache(alg).key();
+    TS_ASSERT(!key.empty());
+
+    alg.setProperty<MatrixWorkspace_sptr>("InputWorkspace",
+                                          workspaceWithValue(1.0));
+    TS_ASSERT_EQUALS(AlgorithmResultCache(alg).key(), key);
+
+    alg.setProperty<MatrixWorkspace_sptr>("InputWorkspace",
+                                          workspaceWithValue(2.0));
+    TS_ASSERT_DIFFERS(AlgorithmResultCache(alg).key(), key);
+  }
+
+  void test_key_depends_on_changes_not_recorded_in_history() {
+    CachedAlgorithm alg;
+    alg.initialize();
+    auto ws = workspaceWithValue(1.0);
+    alg.setProperty<MatrixWorkspace_sptr>("InputWorkspace", ws);
+    const auto key = AlgorithmResultCache(alg).key();
+
+    const double error = ws->e(1)[0];
+    ws->mutableE(1)[0] = error + 5.0;
+    TS_ASSERT_DIFFERS(AlgorithmResultCache(alg).key(), key);
+    ws->mutableE(1)[0] = error;
+    TS_ASSERT_EQUALS(AlgorithmResultCache(alg).key(), key);
+    ws->mutableX(0)[2] += 7.0;
+    TS_ASSERT_DIFFERS(AlgorithmResultCache(alg).key(), key);
+  }
+
+  void test_algorithm_with_output_value_is_not_cached() {
+    AlgorithmWithValueOutput alg;
+    alg.initialize();
+    TS_ASSERT(AlgorithmResultCache(alg).key().empty());
+  }
+
+  void test_load_misses_when_nothing_was_stored() {
+    CachedAlgorithm alg;
+    alg.initialize();
+    AlgorithmResultCache cache(alg);
+    TS_ASSERT(!cache.key().empty());
+    TS_ASSERT(!cache.load());
+  }
+
+private:
+  const std::string m_directory;
+};
+
+#endif /* MANTID_API_ALGORITHMRESULTCACHETEST_H_ */
@@ -154,6 +154,68 @@ class DataProcessorAlgorithmTest : public CxxTest::TestSuite {
     }
   };
 
+  // child step which passes its input through or creates a new workspace
+  class StepAlgorithm : public Algorithm {
+  public:
+    const std::string name() const override { return "StepAlgorithm"; }
+    int version() const override { return 1; }
+    const std::string category() const override { return "Cat;Leopard;Mink"; }
+    const std::string summary() const override { return "StepAlgorithm"; }
+
+    void init() override {
+      declareProperty(std::make_unique<WorkspaceProperty<MatrixWorkspace>>(
+          "InputWorkspace", "", Direction::Input, PropertyMode::Optional));
+      declareProperty(std::make_unique<WorkspaceProperty<MatrixWorkspace>>(
+          "OutputWorkspace", "", Direction::Output));
+    }
+    void exec() override {
+      MatrixWorkspace_sptr input = getProperty("InputWorkspace");
+      if (!input)
+        input = boost::make_shared<WorkspaceTester>();
+      setProperty("OutputWorkspace", input);
+    }
+  };
+
+  // runs two independent branches of two steps each with executeChildSteps
+  class GraphAlgorithm : public DataProcessorAlgorithm {
+  public:
+    const std::string name() const override { return "GraphAlgorithm"; }
+    int version() const override { return 1; }
+    const std::string category() const override { return "Cat;Leopard;Mink"; }
+    const std::string summary() const override { return "GraphAlgorithm"; }
+
+    void init() override {
+      declareProperty(std::make_unique<WorkspaceProperty<MatrixWorkspace>>(
+          "OutputWorkspace", "", Direction::Output));
+      declareProperty("Cycle", false, Direction::Input);
+    }
+    void exec() override {
+      std::vector<Algorithm_sptr> algs;
+      for (const auto &name : {"correctA", "loadB", "loadA", "correctB"}) {
+        algs.emplace_back(createChildAlgorithm("StepAlgorithm"));
+        algs.back()->initialize();
+        algs.back()->setPropertyValue("OutputWorkspace", name);
+      }
+      // added in an order that does not respect the dependencies
+      const auto loadA = addChildStep(algs[2]);
+      const auto correctA = addChildStep(algs[0]);
+      const auto loadB = addChildStep(algs[1]);
+      const auto correctB = addChildStep(algs[3]);
+      connectChildSteps(loadA, "OutputWorkspace", correctA, "InputWorkspace");
+      connectChildSteps(loadB, "OutputWorkspace", correctB, "InputWorkspace");
+      if (static_cast<bool>(getProperty("Cycle")))
+        connectChildSteps(correctA, "OutputWorkspace", loadA, "InputWorkspace");
+      executeChildSteps();
+
+      MatrixWorkspace_sptr loadedA = algs[2]->getProperty("OutputWorkspace");
+      MatrixWorkspace_sptr correctedA = algs[0]->getProperty("OutputWorkspace");
+      MatrixWorkspace_sptr correctedB = algs[3]->getProperty("OutputWorkspace");
+      if (loadedA != correctedA || correctedA == correctedB)
+        throw std::runtime_error("Steps were not connected");
+      setProperty("OutputWorkspace", correctedA);
+    }
+  };
+
 public:
   // This pair of boilerplate methods prevent the suite being created statically
   // This means the constructor isn't called when running other tests
@@ -167,6 +229,8 @@ public:
     Mantid::API::AlgorithmFactory::Instance().subscribe<NestedAlgorithm>();
     Mantid::API::AlgorithmFactory::Instance().subscribe<BasicAlgorithm>();
     Mantid::API::AlgorithmFactory::Instance().subscribe<SubAlgorithm>();
+    Mantid::API::AlgorithmFactory::Instance().subscribe<StepAlgorithm>();
+    Mantid::API::AlgorithmFactory::Instance().subscribe<GraphAlgorithm>();
   }
 
   void tearDown() override {
@@ -175,6 +239,8 @@ public:
     Mantid::API::AlgorithmFactory::Instance().unsubscribe("NestedAlgorithm", 1);
     Mantid::API::AlgorithmFactory::Instance().unsubscribe("BasicAlgorithm", 1);
     Mantid::API::AlgorithmFactory::Instance().unsubscribe("SubAlgorithm", 1);
+    Mantid::API::AlgorithmFactory::Instance().unsubscribe("StepAlgorithm", 1);
+    Mantid::API::AlgorithmFactory::Instance().unsubscribe("GraphAlgorithm", 1);
   }
 
   void test_Nested_History() {
@@ -250,6 +316,43 @@ public:
     AnalysisDataService::Instance().remove("test_output_workspace");
     AnalysisDataService::Instance().remove("test_input_workspace");
   }
+
+  void test_executeChildSteps_runs_connected_steps() {
+    GraphAlgorithm alg;
+    alg.initialize();
+    alg.setRethrows(true);
+    alg.setPropertyValue("OutputWorkspace", "test_output_workspace");
+
+    TS_ASSERT_THROWS_NOTHING(alg.execute());
+    TS_ASSERT(alg.isExecuted());
+
+    auto ws = AnalysisDataService::Instance().retrieveWS<MatrixWorkspace>(
+        "test_output_workspace");
+    auto algHist = ws->getHistory().getAlgorithmHistory(0);
+    TS_ASSERT_EQUALS(algHist->name(), "GraphAlgorithm");
+    TS_ASSERT_EQUALS(algHist->childHistorySize(), 4);
+    // each round is recorded in the order the steps were added
+    const std::vector<std::string> expected{"loadA", "loadB", "correctA",
+                                            "correctB"};
+    const auto size = std::min(expected.size(), algHist->childHistorySize());
+    for (size_t i = 0; i < size; ++i)
+      TS_ASSERT_EQUALS(algHist->getChildAlgorithmHistory(i)->getPropertyValue(
+                           "OutputWorkspace"),
+                       expected[i]);
+
+    AnalysisDataService::Instance().remove("test_output_workspace");
+  }
+
+  void test_executeChildSteps_throws_for_cycle() {
+    GraphAlgorithm alg;
+    alg.initialize();
+    alg.setRethrows(true);
+    alg.setProperty("Cycle", true);
+    alg.setPropertyValue("OutputWorkspace", "test_output_workspace");
+
+    TS_ASSERT_THROWS(alg.execute(), const std::runtime_error &);
+    TS_ASSERT(!alg.isExecuted());
+  }
 };
 
 #endif /* MANTID_API_DATAPROCESSORALGORITHMTEST_H_ */
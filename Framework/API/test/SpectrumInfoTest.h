@@ -282,6 +282,62 @@ public:
     detectorInfo.setPosition(1, oldPos);
   }
 
+  void test_geometry() {
+    const auto &spectrumInfo = m_workspace.spectrumInfo();
+    const auto geometry = spectrumInfo.geometry();
+    TS_ASSERT_EQUALS(geometry.size(), 5);
+    for (size_t i = 0; i < geometry.size(); ++i) {
+      TS_ASSERT_EQUALS(geometry.l2[i], spectrumInfo.l2(i));
+    }
+    for (size_t i = 0; i < 3; ++i) {
+      TS_ASSERT_EQUALS(geometry.twoTheta[i], spectrumInfo.twoTheta(i));
+      TS_ASSERT_EQUALS(geometry.signedTwoTheta[i],
+                       spectrumInfo.signedTwoTheta(i));
+      const auto direction = normalize(spectrumInfo.position(i) -
+                                       spectrumInfo.samplePosition());
+      TS_ASSERT_DELTA(geometry.directionX[i], direction.X(), 1e-12);
+      TS_ASSERT_DELTA(geometry.directionY[i], direction.Y(), 1e-12);
+      TS_ASSERT_DELTA(geometry.directionZ[i], direction.Z(), 1e-12);
+    }
+    TS_ASSERT_DELTA(geometry.azimuthal[0], -M_PI / 2.0, 1e-12);
+    TS_ASSERT_DELTA(geometry.azimuthal[1], 0.0, 1e-12);
+    TS_ASSERT_DELTA(geometry.azimuthal[2], M_PI / 2.0, 1e-12);
+    // Monitors
+    TS_ASSERT(std::isnan(geometry.twoTheta[3]));
+    TS_ASSERT(std::isnan(geometry.signedTwoTheta[3]));
+    TS_ASSERT(std::isnan(geometry.twoTheta[4]));
+    TS_ASSERT(std::isnan(geometry.signedTwoTheta[4]));
+  }
+
+  void test_grouped_geometry() {
+    const auto &spectrumInfo = m_grouped.spectrumInfo();
+    const auto geometry = spectrumInfo.geometry();
+    for (size_t i = 0; i < geometry.size(); ++i) {
+      TS_ASSERT_EQUALS(geometry.l2[i], spectrumInfo.l2(i));
+    }
+    for (const auto i : {GroupOfDets2And3, GroupOfDets1And2}) {
+      TS_ASSERT_EQUALS(geometry.twoTheta[i], spectrumInfo.twoTheta(i));
+      TS_ASSERT_EQUALS(geometry.signedTwoTheta[i],
+                       spectrumInfo.signedTwoTheta(i));
+    }
+    // Groups including monitors have no scattering angle
+    for (const auto i : {GroupOfDets1And4, GroupOfDets4And5, GroupOfAllDets}) {
+      TS_ASSERT(std::isnan(geometry.twoTheta[i]));
+      TS_ASSERT(std::isnan(geometry.signedTwoTheta[i]));
+    }
+  }
+
+  void test_geometry_of_spectrum_without_detectors() {
+    auto ws = makeDefaultWorkspace();
+    ws.getSpectrum(1).clearDetectorIDs();
+    const auto geometry = ws.spectrumInfo().geometry();
+    TS_ASSERT_EQUALS(geometry.l2[0], ws.spectrumInfo().l2(0));
+    TS_ASSERT(std::isnan(geometry.l2[1]));
+    TS_ASSERT(std::isnan(geometry.twoTheta[1]));
+    TS_ASSERT(std::isnan(geometry.azimuthal[1]));
+    TS_ASSERT(std::isnan(geometry.directionX[1]));
+  }
+
   void test_hasDetectors() {
     const auto &spectrumInfo = m_workspace.spectrumInfo();
     TS_ASSERT(spectrumInfo.hasDetectors(0));
@@ -15,9 +15,11 @@
 #include "MantidGeometry/Instrument/ParameterMap.h"
 #include "MantidGeometry/Instrument/RectangularDetector.h"
 #include "MantidGeometry/Objects/BoundingBox.h"
+#include "MantidKernel/MultiThreaded.h"
 #include "MantidTestHelpers/ComponentCreationHelper.h"
 #include "MantidTestHelpers/FakeObjects.h"
 #include <cxxtest/TestSuite.h>
+#include <algorithm>
 #include <map>
 
 using namespace Mantid;
@@ -178,6 +180,26 @@ public:
     TS_ASSERT_EQUALS(nb.size(), 4);
   }
 
+  void testParallelSearchMatchesSerialSearch() {
+    const auto ws = makeWorkspace(256, 767);
+    ws->setInstrument(
+        ComponentCreationHelper::createTestInstrumentRectangular(2, 16));
+    const auto &spectrumInfo = ws->spectrumInfo();
+    const auto spectrumNumbers = getSpectrumNumbers(*ws);
+
+    const int numThreads = PARALLEL_GET_MAX_THREADS;
+    PARALLEL_SET_NUM_THREADS(std::max(numThreads, 4));
+    WorkspaceNearestNeighbours parallelNN(8, spectrumInfo, spectrumNumbers);
+    PARALLEL_SET_NUM_THREADS(1);
+    WorkspaceNearestNeighbours serialNN(8, spectrumInfo, spectrumNumbers);
+    PARALLEL_SET_NUM_THREADS(numThreads);
+
+    for (const auto spectrum : spectrumNumbers) {
+      TS_ASSERT_EQUALS(parallelNN.neighbours(spectrum),
+                       serialNN.neighbours(spectrum));
+    }
+  }
+
   void testIgnoreAndApplyMasking() {
     const auto ws = makeWorkspace(1, 18);
     ws->setInstrument(
@@ -15,11 +15,15 @@
 #include "MantidKernel/Material.h"
 #include "MantidKernel/V3D.h"
 
+#include <memory>
+
 namespace Mantid {
 
 namespace API {
+class Progress;
 class Sample;
-}
+class SpectrumInfo;
+} // namespace API
 namespace Geometry {
 class IDetector;
 class IObject;
@@ -58,6 +62,11 @@ namespace Algorithms {
     and a numerical integration is carried out using these path lengths over the
    volume elements.
 
+    The path lengths from each element to every detector only depend on the
+   geometry. Those of the most recent execution are kept and reused when the
+   algorithm is run again on the same sample and instrument, e.g. for a series
+   of runs.
+
     This algorithm assumes that the beam comes along the Z axis, that Y is up
     and that the sample is at the origin.
 
@@ -119,15 +128,16 @@ private:
 
   void retrieveBaseProperties();
   void constructSample(API::Sample &sample);
-  void calculateDistances(const Geometry::IDetector &detector,
-                          std::vector<double> &L2s) const;
-  inline double doIntegration(const double linearCoefAbs,
-                              const std::vector<double> &L2s,
+  struct PathLengthTable;
+  std::shared_ptr<const PathLengthTable>
+  findPathLengths(const API::SpectrumInfo &spectrumInfo, API::Progress &prog);
+  void calculateDistances(const Kernel::V3D &detectorPos,
+                          std::vector<double>::iterator L2s) const;
+  inline double doIntegration(const double linearCoefAbs, const double *L2s,
                               const size_t startIndex,
                               const size_t endIndex) const;
   inline double doIntegration(const double linearCoefAbsL1,
-                              const double linearCoefAbsL2,
-                              const std::vector<double> &L2s,
+                              const double linearCoefAbsL2, const double *L2s,
                               const size_t startIndex,
                               const size_t endIndex) const;
 
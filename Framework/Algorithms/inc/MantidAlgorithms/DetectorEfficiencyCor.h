@@ -10,10 +10,12 @@
 #include "MantidAPI/Algorithm.h"
 #include "MantidAPI/SpectrumInfo.h"
 #include "MantidGeometry/IDetector.h"
+#include "MantidGeometry/Instrument/Parameter.h"
 #include "MantidGeometry/Objects/IObject.h"
 #include "MantidKernel/V3D.h"
 
 #include <list>
+#include <vector>
 
 namespace Mantid {
 namespace Algorithms {
@@ -117,8 +119,10 @@ private:
   API::MatrixWorkspace_const_sptr m_inputWS;
   /// output workspace, maybe the same as the input one
   API::MatrixWorkspace_sptr m_outputWS;
-  /// points the map that stores additional properties for detectors in that map
-  const Geometry::ParameterMap *m_paraMap;
+  /// the gas pressure parameter of each detector, by detector index
+  std::vector<Geometry::Parameter_sptr> m_pressures;
+  /// the wall thickness parameter of each detector, by detector index
+  std::vector<Geometry::Parameter_sptr> m_wallThicknesses;
 
   /// stores the user selected value for incidient energy of the neutrons
   double m_Ei;
@@ -10,6 +10,7 @@
 #include "MantidAlgorithms/DllConfig.h"
 #include "MantidAlgorithms/SampleCorrections/MCInteractionVolume.h"
 #include <tuple>
+#include <vector>
 
 namespace Mantid {
 namespace API {
@@ -30,16 +31,29 @@ class IBeamProfile;
 
   The error on all points is defined to be \f$\frac{1}{\sqrt{N}}\f$, where N is
   the number of events generated.
+
+  The correction for several wavelengths can also be calculated from the same
+  set of tracks. The error is then the standard error of the mean and, if a
+  target relative error is given, further sets of events are added until every
+  wavelength reaches it or the maximum number of events is used.
 */
 class MANTID_ALGORITHMS_DLL MCAbsorptionStrategy {
 public:
   MCAbsorptionStrategy(const IBeamProfile &beamProfile,
                        const API::Sample &sample, size_t nevents,
-                       size_t maxScatterPtAttempts);
+                       size_t maxScatterPtAttempts,
+                       double targetRelativeError = 0.0,
+                       size_t maxEvents = 0);
   std::tuple<double, double> calculate(Kernel::PseudoRandomNumberGenerator &rng,
                                        const Kernel::V3D &finalPos,
                                        double lambdaBefore,
                                        double lambdaAfter) const;
+  void calculate(Kernel::PseudoRandomNumberGenerator &rng,
+                 const Kernel::V3D &finalPos,
+                 const std::vector<double> &lambdasBefore,
+                 const std::vector<double> &lambdasAfter,
+                 std::vector<double> &attenuationFactors,
+                 std::vector<double> &attenuationFactorErrors) const;
 
 private:
   const IBeamProfile &m_beamProfile;
@@ -47,6 +61,8 @@ private:
   const size_t m_nevents;
   const size_t m_maxScatterAttempts;
   const double m_error;
+  const double m_targetRelativeError;
+  const size_t m_maxEvents;
 };
 
 } // namespace Algorithms
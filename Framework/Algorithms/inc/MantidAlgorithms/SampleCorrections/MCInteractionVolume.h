@@ -17,6 +17,7 @@ class Sample;
 namespace Geometry {
 class IObject;
 class SampleEnvironment;
+class Track;
 } // namespace Geometry
 
 namespace Kernel {
@@ -46,6 +47,10 @@ public:
                              const Kernel::V3D &startPos,
                              const Kernel::V3D &endPos, double lambdaBefore,
                              double lambdaAfter) const;
+  bool generateTracks(Kernel::PseudoRandomNumberGenerator &rng,
+                      const Kernel::V3D &startPos, const Kernel::V3D &endPos,
+                      Geometry::Track &beforeScatter,
+                      Geometry::Track &afterScatter) const;
 
 private:
   const boost::shared_ptr<Geometry::IObject> m_sample;
@@ -14,6 +14,7 @@
 #include "MantidGeometry/IDetector.h"
 #include "MantidGeometry/Instrument.h"
 #include "MantidGeometry/Instrument/SampleEnvironment.h"
+#include "MantidGeometry/Objects/CSGObject.h"
 #include "MantidGeometry/Objects/ShapeFactory.h"
 #include "MantidGeometry/Objects/Track.h"
 #include "MantidHistogramData/Interpolate.h"
@@ -28,6 +29,10 @@
 #include "MantidKernel/Unit.h"
 #include "MantidKernel/UnitFactory.h"
 
+#include <array>
+#include <memory>
+#include <mutex>
+
 namespace Mantid {
 namespace Algorithms {
 
@@ -43,6 +48,9 @@ using PhysicalConstants::E_mev_toNeutronWavenumberSq;
 namespace {
 // the maximum number of elements to combine at once in the pairwise summation
 constexpr size_t MAX_INTEGRATION_LENGTH{1000};
+// the maximum number of path lengths kept in a table (256MB), larger tables
+// are not stored and the path lengths are calculated spectrum by spectrum
+constexpr size_t MAX_PATH_LENGTH_TABLE_SIZE{32 * 1024 * 1024};
 
 const std::string CALC_SAMPLE = "Sample";
 const std::string CALC_CONTAINER = "Container";
@@ -59,8 +67,41 @@ double energyToWavelength(const double energyFixed) {
   return 2. * M_PI * std::sqrt(E_mev_toNeutronWavenumberSq / energyFixed);
 }
 
+/// The position used for the path lengths to a detector. Grouped detectors use
+/// the average scattering angles.
+V3D detectorPosition(const IDetector &detector) {
+  V3D detectorPos(detector.getPos());
+  if (detector.nDets() > 1) {
+    detectorPos.spherical(detectorPos.norm(),
+                          detector.getTwoTheta(V3D(), V3D(0, 0, 1)) * 180.0 /
+                              M_PI,
+                          detector.getPhi() * 180.0 / M_PI);
+  }
+  return detectorPos;
+}
+
 } // namespace
 
+/// The L2 path lengths of every element to the detector of every spectrum,
+/// stored spectrum by spectrum, along with the geometry they were found for
+struct AbsorptionCorrection::PathLengthTable {
+  /// True if the path lengths in other can be used for this geometry
+  bool sameGeometry(const PathLengthTable &other) const {
+    return shapeXML == other.shapeXML && boxMin == other.boxMin &&
+           boxMax == other.boxMax &&
+           elementPositions == other.elementPositions && L1s == other.L1s &&
+           hasDetector == other.hasDetector &&
+           detectorPositions == other.detectorPositions;
+  }
+  std::string shapeXML;
+  V3D boxMin, boxMax;
+  std::vector<V3D> elementPositions;
+  std::vector<double> L1s;
+  std::vector<bool> hasDetector;
+  std::vector<V3D> detectorPositions;
+  std::vector<double> L2s;
+};
+
 AbsorptionCorrection::AbsorptionCorrection()
     : API::Algorithm(), m_inputWS(), m_sampleObject(nullptr), m_L1s(),
       m_elementVolumes(), m_elementPositions(), m_numVolumeElements(0),
@@ -214,7 +255,21 @@ void AbsorptionCorrection::exec() {
   }
 
   const auto &spectrumInfo = m_inputWS->spectrumInfo();
-  Progress prog(this, 0.0, 1.0, numHists);
+  Progress prog(this, 0.0, 1.0, 2 * numHists);
+
+  // The path lengths only depend on the geometry so reuse those of the last
+  // execution if the sample and the detectors have not changed. Tables which
+  // are too large are not kept.
+  std::shared_ptr<const PathLengthTable> table;
+  if (static_cast<size_t>(numHists) * m_numVolumeElements <=
+      MAX_PATH_LENGTH_TABLE_SIZE) {
+    table = findPathLengths(spectrumInfo, prog);
+  } else {
+    g_log.information("Too many path lengths to keep, calculating them for "
+                      "each spectrum");
+    prog.reportIncrement(numHists);
+  }
+
   // Loop over the spectra
   PARALLEL_FOR_IF(Kernel::threadSafe(*m_inputWS, *correctionFactors))
   for (int64_t i = 0; i < int64_t(numHists); ++i) {
@@ -228,9 +283,15 @@ void AbsorptionCorrection::exec() {
       continue;
     }
     const auto &det = spectrumInfo.detector(i);
-
-    std::vector<double> L2s(m_numVolumeElements);
-    calculateDistances(det, L2s);
+    std::vector<double> spectrumL2s;
+    const double *L2s;
+    if (table) {
+      L2s = table->L2s.data() + i * m_numVolumeElements;
+    } else {
+      spectrumL2s.resize(m_numVolumeElements);
+      calculateDistances(detectorPosition(det), spectrumL2s.begin());
+      L2s = spectrumL2s.data();
+    }
 
     // If an indirect instrument, see if there's an efixed in the parameter map
     double lambdaFixed = m_lambdaFixed;
@@ -258,13 +319,14 @@ void AbsorptionCorrection::exec() {
     // Loop through the bins in the current spectrum every m_xStep
     for (int64_t j = 0; j < specSize; j = j + m_xStep) {
       if (m_emode == DeltaEMode::Elastic) {
-        Y[j] = this->doIntegration(-linearCoefAbs[j], L2s, 0, L2s.size());
+        Y[j] = this->doIntegration(-linearCoefAbs[j], L2s, 0,
+                                   m_numVolumeElements);
       } else if (m_emode == DeltaEMode::Direct) {
         Y[j] = this->doIntegration(linearCoefAbsFixed, -linearCoefAbs[j], L2s,
-                                   0, L2s.size());
+                                   0, m_numVolumeElements);
       } else if (m_emode == DeltaEMode::Indirect) {
         Y[j] = this->doIntegration(-linearCoefAbs[j], linearCoefAbsFixed, L2s,
-                                   0, L2s.size());
+                                   0, m_numVolumeElements);
       } else { // should never happen
         throw std::runtime_error(
             "AbsorptionCorrection doesn't have a known DeltaEMode defined");
@@ -415,60 +477,94 @@ void AbsorptionCorrection::constructSample(API::Sample &sample) {
   }
 }
 
-/// Calculate the distances traversed by the neutrons within the sample
-/// @param detector :: The detector we are working on
-/// @param L2s :: A vector of the sample-detector distance for  each segment of
-/// the sample
-void AbsorptionCorrection::calculateDistances(const IDetector &detector,
-                                              std::vector<double> &L2s) const {
-  V3D detectorPos(detector.getPos());
-  if (detector.nDets() > 1) {
-    // We need to make sure this is right for grouped detectors - should use
-    // average theta & phi
-    detectorPos.spherical(detectorPos.norm(),
-                          detector.getTwoTheta(V3D(), V3D(0, 0, 1)) * 180.0 /
-                              M_PI,
-                          detector.getPhi() * 180.0 / M_PI);
+/// Find the path lengths for the current geometry, reusing those of the
+/// previous execution if the sample and the detectors have not changed. Only
+/// the table of the most recent execution is kept, and only for samples
+/// defined by CSG shapes, which can be compared through their XML.
+/// @param spectrumInfo :: The spectrum info of the input workspace
+/// @param prog :: The progress reporter
+/// @returns The path lengths from every element to every detector
+std::shared_ptr<const AbsorptionCorrection::PathLengthTable>
+AbsorptionCorrection::findPathLengths(const SpectrumInfo &spectrumInfo,
+                                      Progress &prog) {
+  static std::shared_ptr<const PathLengthTable> lastPathLengths;
+  static std::mutex lastPathLengthsMutex;
+
+  const auto numHists = static_cast<int64_t>(spectrumInfo.size());
+  auto pathLengths = std::make_shared<PathLengthTable>();
+  const auto csgObject = dynamic_cast<const CSGObject *>(m_sampleObject);
+  if (csgObject)
+    pathLengths->shapeXML = csgObject->getShapeXML();
+  pathLengths->boxMin = m_sampleObject->getBoundingBox().minPoint();
+  pathLengths->boxMax = m_sampleObject->getBoundingBox().maxPoint();
+  pathLengths->elementPositions = m_elementPositions;
+  pathLengths->L1s = m_L1s;
+  pathLengths->hasDetector.resize(static_cast<size_t>(numHists));
+  pathLengths->detectorPositions.resize(static_cast<size_t>(numHists));
+  for (int64_t i = 0; i < numHists; ++i) {
+    if (spectrumInfo.hasDetectors(i)) {
+      pathLengths->hasDetector[i] = true;
+      pathLengths->detectorPositions[i] =
+          detectorPosition(spectrumInfo.detector(i));
+    }
+  }
+  {
+    std::lock_guard<std::mutex> lock(lastPathLengthsMutex);
+    if (csgObject && lastPathLengths &&
+        lastPathLengths->sameGeometry(*pathLengths)) {
+      g_log.information("Reusing the path lengths of the previous execution");
+      prog.reportIncrement(numHists);
+      return lastPathLengths;
+    }
+    // Release the old table before building a new one
+    lastPathLengths.reset();
   }
 
-  for (size_t i = 0; i < m_numVolumeElements; ++i) {
-    // Create track for distance in cylinder between scattering point and
-    // detector
-    const V3D direction = normalize(detectorPos - m_elementPositions[i]);
-    Track outgoing(m_elementPositions[i], direction);
-    int temp = m_sampleObject->interceptSurface(outgoing);
-
-    /* Most of the time, the number of hits is 1. Sometime, we have more than
-     * one intersection due to
-     * arithmetic imprecision. If it is the case, then selecting the first
-     * intersection is valid.
-     * In principle, one could check the consistency of all distances if hits is
-     * larger than one by doing:
-     * Mantid::Geometry::Track::LType::const_iterator it=outgoing.begin();
-     * and looping until outgoing.end() checking the distances with it->Dist
-     */
-    // Not hitting the cylinder from inside, usually means detector is badly
-    // defined,
-    // i.e, position is (0,0,0).
-    if (temp < 1) {
-      // FOR NOW AT LEAST, JUST IGNORE THIS ERROR AND USE A ZERO PATH LENGTH,
-      // WHICH I RECKON WILL MAKE A
-      // NEGLIGIBLE DIFFERENCE ANYWAY (ALWAYS SEEMS TO HAPPEN WITH ELEMENT RIGHT
-      // AT EDGE OF SAMPLE)
-      L2s[i] = 0.0;
-
-      // std::ostringstream message;
-      // message << "Problem with detector at " << detectorPos << " ID:" <<
-      // detector->getID() << '\n';
-      // message << "This usually means that this detector is defined inside the
-      // sample cylinder";
-      // g_log.error(message.str());
-      // throw std::runtime_error("Problem in
-      // AbsorptionCorrection::calculateDistances");
-    } else // The normal situation
-    {
-      L2s[i] = outgoing.cbegin()->distFromStart;
+  pathLengths->L2s.resize(static_cast<size_t>(numHists) * m_numVolumeElements);
+  PARALLEL_FOR_IF(Kernel::threadSafe(*m_inputWS))
+  for (int64_t i = 0; i < numHists; ++i) {
+    PARALLEL_START_INTERUPT_REGION
+    if (pathLengths->hasDetector[i]) {
+      calculateDistances(pathLengths->detectorPositions[i],
+                         pathLengths->L2s.begin() + i * m_numVolumeElements);
     }
+    prog.report();
+    PARALLEL_END_INTERUPT_REGION
+  }
+  PARALLEL_CHECK_INTERUPT_REGION
+  if (csgObject) {
+    std::lock_guard<std::mutex> lock(lastPathLengthsMutex);
+    lastPathLengths = pathLengths;
+  }
+  return pathLengths;
+}
+
+/// Calculate the distances traversed by the neutrons within the sample
+/// @param detectorPos :: The position of the detector we are working on
+/// @param L2s :: The start of the sample-detector distances for each segment
+/// of the sample
+void AbsorptionCorrection::calculateDistances(
+    const V3D &detectorPos, std::vector<double>::iterator L2s) const {
+  std::vector<V3D> directions(m_numVolumeElements);
+  for (size_t i = 0; i < m_numVolumeElements; ++i)
+    directions[i] = normalize(detectorPos - m_elementPositions[i]);
+
+  // The scattered neutron is attenuated in every section of the sample it
+  // crosses on its way to the detector, not only up to where it first leaves
+  // a hollow or re-entrant shape. A track that does not leave the sample,
+  // usually because the element is right at its edge, gets a zero path length
+  if (const auto csgObject = dynamic_cast<const CSGObject *>(m_sampleObject)) {
+    std::vector<double> distances;
+    csgObject->distancesInside(m_elementPositions, directions, distances);
+    std::copy(distances.cbegin(), distances.cend(), L2s);
+    return;
+  }
+  for (size_t i = 0; i < m_numVolumeElements; ++i) {
+    Track outgoing(m_elementPositions[i], directions[i]);
+    m_sampleObject->interceptSurface(outgoing);
+    L2s[i] = 0.0;
+    for (const auto &link : outgoing)
+      L2s[i] += link.distInsideObject;
   }
 }
 
@@ -479,7 +575,7 @@ void AbsorptionCorrection::calculateDistances(const IDetector &detector,
 /// Carries out the numerical integration over the sample for elastic
 /// instruments
 double AbsorptionCorrection::doIntegration(const double linearCoefAbs,
-                                           const std::vector<double> &L2s,
+                                           const double *L2s,
                                            const size_t startIndex,
                                            const size_t endIndex) const {
   if (endIndex - startIndex > MAX_INTEGRATION_LENGTH) {
@@ -488,13 +584,17 @@ double AbsorptionCorrection::doIntegration(const double linearCoefAbs,
     return doIntegration(linearCoefAbs, L2s, startIndex, middle) +
            doIntegration(linearCoefAbs, L2s, middle, endIndex);
   } else {
-    double integral = 0.0;
+    // Find all the exponents first in a loop that can be vectorised
+    std::array<double, MAX_INTEGRATION_LENGTH> exponents;
+    const double linearCoef = linearCoefAbs + m_linearCoefTotScatt;
+    for (size_t i = startIndex; i < endIndex; ++i) {
+      exponents[i - startIndex] = linearCoef * (m_L1s[i] + L2s[i]);
+    }
 
     // Iterate over all the elements, summing up the integral
+    double integral = 0.0;
     for (size_t i = startIndex; i < endIndex; ++i) {
-      const double exponent =
-          (linearCoefAbs + m_linearCoefTotScatt) * (m_L1s[i] + L2s[i]);
-      integral += (EXPONENTIAL(exponent) * (m_elementVolumes[i]));
+      integral += EXPONENTIAL(exponents[i - startIndex]) * m_elementVolumes[i];
     }
 
     return integral;
@@ -505,7 +605,7 @@ double AbsorptionCorrection::doIntegration(const double linearCoefAbs,
 /// instruments
 double AbsorptionCorrection::doIntegration(const double linearCoefAbsL1,
                                            const double linearCoefAbsL2,
-                                           const std::vector<double> &L2s,
+                                           const double *L2s,
                                            const size_t startIndex,
                                            const size_t endIndex) const {
   if (endIndex - startIndex > MAX_INTEGRATION_LENGTH) {
@@ -516,13 +616,19 @@ double AbsorptionCorrection::doIntegration(const double linearCoefAbsL1,
            doIntegration(linearCoefAbsL1, linearCoefAbsL2, L2s, middle,
                          endIndex);
   } else {
-    double integral = 0.0;
+    // Find all the exponents first in a loop that can be vectorised
+    std::array<double, MAX_INTEGRATION_LENGTH> exponents;
+    const double linearCoefL1 = linearCoefAbsL1 + m_linearCoefTotScatt;
+    const double linearCoefL2 = linearCoefAbsL2 + m_linearCoefTotScatt;
+    for (size_t i = startIndex; i < endIndex; ++i) {
+      exponents[i - startIndex] =
+          linearCoefL1 * m_L1s[i] + linearCoefL2 * L2s[i];
+    }
 
     // Iterate over all the elements, summing up the integral
+    double integral = 0.0;
     for (size_t i = startIndex; i < endIndex; ++i) {
-      double exponent = (linearCoefAbsL1 + m_linearCoefTotScatt) * m_L1s[i];
-      exponent += (linearCoefAbsL2 + m_linearCoefTotScatt) * L2s[i];
-      integral += (EXPONENTIAL(exponent) * (m_elementVolumes[i]));
+      integral += EXPONENTIAL(exponents[i - startIndex]) * m_elementVolumes[i];
     }
 
     return integral;
@@ -206,6 +206,8 @@ void DiffractionFocussing2::exec() {
     // Initialize the group's weight vector here and the dummy vector used for
     // accumulating errors.
     MantidVec groupWgt(nPoints, 0.0);
+    // Buffers the events of each input spectrum are histogrammed into
+    MantidVec eventY, eventE;
 
     // loop through the contributing histograms
     const std::vector<size_t> &indices = m_wsIndices[outWorkspaceIndex];
@@ -214,17 +216,27 @@ void DiffractionFocussing2::exec() {
       size_t inWorkspaceIndex = indices[i];
       // This is the input spectrum
       const auto &inSpec = m_matrixInputW->getSpectrum(inWorkspaceIndex);
-      // Get reference to its old X,Y,and E.
+      // Get reference to its old X
       auto &Xin = inSpec.x();
-      auto &Yin = inSpec.y();
-      auto &Ein = inSpec.e();
       outSpec.addDetectorIDs(inSpec.getDetectorIDs());
 
       try {
-        // TODO This should be implemented in Histogram as rebin
-        Mantid::Kernel::VectorHelper::rebinHistogram(
-            Xin.rawData(), Yin.rawData(), Ein.rawData(), Xout.rawData(), Yout,
-            Eout, true);
+        if (m_eventW) {
+          // Histogram the events into scratch buffers rather than asking the
+          // spectrum for its histogram, which would build it and store it in
+          // the MRU of the workspace under a lock. The values are the same.
+          eventY.clear();
+          eventE.clear();
+          m_eventW->getSpectrum(inWorkspaceIndex)
+              .generateHistogram(Xin.rawData(), eventY, eventE);
+          Mantid::Kernel::VectorHelper::rebinHistogram(
+              Xin.rawData(), eventY, eventE, Xout.rawData(), Yout, Eout, true);
+        } else {
+          // TODO This should be implemented in Histogram as rebin
+          Mantid::Kernel::VectorHelper::rebinHistogram(
+              Xin.rawData(), inSpec.y().rawData(), inSpec.e().rawData(),
+              Xout.rawData(), Yout, Eout, true);
+        }
       } catch (...) {
         // Should never happen because Xout is constructed to envelop all of the
         // Xin vectors
@@ -404,10 +416,14 @@ void DiffractionFocussing2::execEvent() {
       if (max > totalHistProcess)
         max = totalHistProcess;
 
-      // Make a blank EventList that will accumulate the chunk.
+      // Make a blank EventList that will accumulate the chunk, sized for
+      // exactly the events it will hold.
+      size_t numEventsInChunk = 0;
+      for (int i = wiChunk * chunkSize; i < max; i++)
+        numEventsInChunk += m_eventW->getSpectrum(indices[i]).getNumberEvents();
       EventList chunkEL;
       chunkEL.switchTo(eventWtype);
-      // chunkEL.reserve(numEventsInChunk);
+      chunkEL.reserve(numEventsInChunk);
 
       // process the chunk
       for (int i = wiChunk * chunkSize; i < max; i++) {
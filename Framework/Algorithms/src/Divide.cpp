@@ -33,27 +33,27 @@ void Divide::performBinaryOperation(const HistogramData::Histogram &lhs,
                                     const HistogramData::Histogram &rhs,
                                     HistogramData::HistogramY &YOut,
                                     HistogramData::HistogramE &EOut) {
-  const auto bins = static_cast<int>(lhs.e().size());
-
-  for (int j = 0; j < bins; ++j) {
-    // Get references to the input Y's
-    const double leftY = lhs.y()[j];
-    const double rightY = rhs.y()[j];
-
-    //  error dividing two uncorrelated numbers, re-arrange so that you don't
-    //  get infinity if leftY==0 (when rightY=0 the Y value and the result will
-    //  both be infinity)
-    // (Sa/a)2 + (Sb/b)2 = (Sc/c)2
-    // (Sa c/a)2 + (Sb c/b)2 = (Sc)2
-    // = (Sa 1/b)2 + (Sb (a/b2))2
-    // (Sc)2 = (1/b)2( (Sa)2 + (Sb a/b)2 )
-    EOut[j] = sqrt(pow(lhs.e()[j], 2) + pow(leftY * rhs.e()[j] / rightY, 2)) /
-              fabs(rightY);
-
-    // Copy the result last in case one of the input workspaces is also any
-    // output
-    YOut[j] = leftY / rightY;
+  const auto &lhsY = lhs.y();
+  const auto &lhsE = lhs.e();
+  const auto &rhsY = rhs.y();
+  const auto &rhsE = rhs.e();
+  const size_t bins = lhsE.size();
+  //  error dividing two uncorrelated numbers, re-arrange so that you don't
+  //  get infinity if leftY==0 (when rightY=0 the Y value and the result will
+  //  both be infinity)
+  // (Sa/a)2 + (Sb/b)2 = (Sc/c)2
+  // (Sa c/a)2 + (Sb c/b)2 = (Sc)2
+  // = (Sa 1/b)2 + (Sb (a/b2))2
+  // (Sc)2 = (1/b)2( (Sa)2 + (Sb a/b)2 )
+  for (size_t j = 0; j < bins; ++j) {
+    const double rightError = lhsY[j] * rhsE[j] / rhsY[j];
+    EOut[j] = sqrt(lhsE[j] * lhsE[j] + rightError * rightError) / fabs(rhsY[j]);
   }
+  // Do the values in a separate loop after the errors, in case one of the
+  // input workspaces is also the output. Each loop is then simple enough to
+  // be vectorized.
+  for (size_t j = 0; j < bins; ++j)
+    YOut[j] = lhsY[j] / rhsY[j];
 }
 
 void Divide::performBinaryOperation(const HistogramData::Histogram &lhs,
@@ -65,19 +65,19 @@ void Divide::performBinaryOperation(const HistogramData::Histogram &lhs,
                        "with value zero."
                     << "\n";
 
+  const auto &lhsY = lhs.y();
+  const auto &lhsE = lhs.e();
+  const size_t bins = lhsE.size();
   // Do the right-hand part of the error calculation just once
   const double rhsFactor = pow(rhsE / rhsY, 2);
-  const auto bins = static_cast<int>(lhs.e().size());
-  for (int j = 0; j < bins; ++j) {
-    // Get reference to input Y
-    const double leftY = lhs.y()[j];
-
-    // see comment in the function above for the error formula
-    EOut[j] = sqrt(pow(lhs.e()[j], 2) + pow(leftY, 2) * rhsFactor) / fabs(rhsY);
-    // Copy the result last in case one of the input workspaces is also any
-    // output
-    YOut[j] = leftY / rhsY;
-  }
+  const double absRhsY = fabs(rhsY);
+  // see comment in the function above for the error formula
+  for (size_t j = 0; j < bins; ++j)
+    EOut[j] =
+        sqrt(lhsE[j] * lhsE[j] + lhsY[j] * lhsY[j] * rhsFactor) / absRhsY;
+  // Values last in case the input workspace is also the output
+  for (size_t j = 0; j < bins; ++j)
+    YOut[j] = lhsY[j] / rhsY;
 }
 
 void Divide::setOutputUnits(const API::MatrixWorkspace_const_sptr lhs,
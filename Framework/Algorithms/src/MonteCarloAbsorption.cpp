@@ -149,6 +149,32 @@ void MonteCarloAbsorption::init() {
                   "If a scattering point cannot be generated by increasing "
                   "this value then there is most likely a problem with "
                   "the sample geometry.");
+
+  declareProperty("ResimulateTracksForDifferentWavelengths", true,
+                  "If true, simulate new events for every wavelength point. "
+                  "If false, simulate one set of events for each spectrum and "
+                  "use their path lengths for all wavelength points, which is "
+                  "much faster and gives correction factors that vary "
+                  "smoothly with wavelength.");
+  auto nonNegative = boost::make_shared<Kernel::BoundedValidator<double>>();
+  nonNegative->setLower(0.0);
+  declareProperty("TargetRelativeError", 0.0, nonNegative,
+                  "If greater than zero, keep adding sets of EventsPerPoint "
+                  "events until the standard error of the correction factor "
+                  "relative to its value is at most this at every wavelength "
+                  "point or MaxEventsPerPoint events have been used. Only "
+                  "used if tracks are not resimulated for each wavelength.");
+  declareProperty("MaxEventsPerPoint", 100 * DEFAULT_NEVENTS, positiveInt,
+                  "The largest number of events used to reach "
+                  "TargetRelativeError.");
+  setPropertySettings("TargetRelativeError",
+                      std::make_unique<EnabledWhenProperty>(
+                          "ResimulateTracksForDifferentWavelengths",
+                          ePropertyCriterion::IS_NOT_DEFAULT));
+  setPropertySettings("MaxEventsPerPoint",
+                      std::make_unique<EnabledWhenProperty>(
+                          "ResimulateTracksForDifferentWavelengths",
+                          ePropertyCriterion::IS_NOT_DEFAULT));
 }
 
 /**
@@ -240,12 +266,22 @@ MatrixWorkspace_uptr MonteCarloAbsorption::doSimulation(
   const std::string reportMsg = "Computing corrections";
 
   // Configure strategy
+  const bool resimulateTracks =
+      getProperty("ResimulateTracksForDifferentWavelengths");
+  const double targetRelativeError = getProperty("TargetRelativeError");
+  const int maxEvents = getProperty("MaxEventsPerPoint");
   MCAbsorptionStrategy strategy(*beamProfile, inputWS.sample(), nevents,
-                                maxScatterPtAttempts);
+                                maxScatterPtAttempts, targetRelativeError,
+                                static_cast<size_t>(maxEvents));
 
   const auto &spectrumInfo = simulationWS.spectrumInfo();
+  // With tracks shared between wavelengths the events and the wavelength
+  // points of a spectrum are computed in parallel instead when there are too
+  // few spectra to occupy all threads
+  const bool parallelOverSpectra =
+      resimulateTracks || nhists >= PARALLEL_GET_MAX_THREADS;
 
-  PARALLEL_FOR_IF(Kernel::threadSafe(simulationWS))
+  PARALLEL_FOR_IF(Kernel::threadSafe(simulationWS) && parallelOverSpectra)
   for (int64_t i = 0; i < nhists; ++i) {
     PARALLEL_START_INTERUPT_REGION
 
@@ -264,9 +300,10 @@ MatrixWorkspace_uptr MonteCarloAbsorption::doSimulation(
 
     auto &outY = simulationWS.mutableY(i);
     const auto lambdas = simulationWS.points(i);
-    // Simulation for each requested wavelength point
+    // The requested wavelength points
+    std::vector<int> simulatedBins;
+    std::vector<double> lambdasIn, lambdasOut;
     for (int j = 0; j < nbins; j += lambdaStepSize) {
-      prog.report(reportMsg);
       const double lambdaStep = lambdas[j];
       double lambdaIn(lambdaStep), lambdaOut(lambdaStep);
       if (efixed.emode() == DeltaEMode::Direct) {
@@ -276,14 +313,32 @@ MatrixWorkspace_uptr MonteCarloAbsorption::doSimulation(
       } else {
         // elastic case already initialized
       }
-      std::tie(outY[j], std::ignore) =
-          strategy.calculate(rng, detPos, lambdaIn, lambdaOut);
+      simulatedBins.emplace_back(j);
+      lambdasIn.emplace_back(lambdaIn);
+      lambdasOut.emplace_back(lambdaOut);
 
       // Ensure we have the last point for the interpolation
       if (lambdaStepSize > 1 && j + lambdaStepSize >= nbins && j + 1 != nbins) {
         j = nbins - lambdaStepSize - 1;
       }
     }
+    if (resimulateTracks) {
+      // Simulation for each requested wavelength point
+      for (size_t k = 0; k < simulatedBins.size(); ++k) {
+        prog.report(reportMsg);
+        std::tie(outY[simulatedBins[k]], std::ignore) =
+            strategy.calculate(rng, detPos, lambdasIn[k], lambdasOut[k]);
+      }
+    } else {
+      // One simulation shared by all requested wavelength points
+      std::vector<double> factors, factorErrors;
+      strategy.calculate(rng, detPos, lambdasIn, lambdasOut, factors,
+                         factorErrors);
+      for (size_t k = 0; k < simulatedBins.size(); ++k) {
+        outY[simulatedBins[k]] = factors[k];
+      }
+      prog.reportIncrement(simulatedBins.size(), reportMsg);
+    }
 
     // Interpolate through points not simulated
     if (!useSparseInstrument && lambdaStepSize > 1) {
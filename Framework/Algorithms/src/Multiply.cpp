@@ -20,41 +20,44 @@ void Multiply::performBinaryOperation(const HistogramData::Histogram &lhs,
                                       const HistogramData::Histogram &rhs,
                                       HistogramData::HistogramY &YOut,
                                       HistogramData::HistogramE &EOut) {
-  const size_t bins = lhs.e().size();
+  const auto &lhsY = lhs.y();
+  const auto &lhsE = lhs.e();
+  const auto &rhsY = rhs.y();
+  const auto &rhsE = rhs.e();
+  const size_t bins = lhsE.size();
+  // error multiplying two uncorrelated numbers, re-arrange so that you don't
+  // get infinity if leftY or rightY == 0
+  // (Sa/a)2 + (Sb/b)2 = (Sc/c)2
+  // (Sc)2 = (Sa c/a)2 + (Sb c/b)2
+  //       = (Sa b)2 + (Sb a)2
   for (size_t j = 0; j < bins; ++j) {
-    // Get references to the input Y's
-    const double leftY = lhs.y()[j];
-    const double rightY = rhs.y()[j];
-
-    // error multiplying two uncorrelated numbers, re-arrange so that you don't
-    // get infinity if leftY or rightY == 0
-    // (Sa/a)2 + (Sb/b)2 = (Sc/c)2
-    // (Sc)2 = (Sa c/a)2 + (Sb c/b)2
-    //       = (Sa b)2 + (Sb a)2
-    EOut[j] = sqrt(pow(lhs.e()[j] * rightY, 2) + pow(rhs.e()[j] * leftY, 2));
-
-    // Copy the result last in case one of the input workspaces is also any
-    // output
-    YOut[j] = leftY * rightY;
+    const double leftError = lhsE[j] * rhsY[j];
+    const double rightError = rhsE[j] * lhsY[j];
+    EOut[j] = sqrt(leftError * leftError + rightError * rightError);
   }
+  // Do the values in a separate loop after the errors, in case one of the
+  // input workspaces is also the output. Each loop is then simple enough to
+  // be vectorized.
+  for (size_t j = 0; j < bins; ++j)
+    YOut[j] = lhsY[j] * rhsY[j];
 }
 
 void Multiply::performBinaryOperation(const HistogramData::Histogram &lhs,
                                       const double rhsY, const double rhsE,
                                       HistogramData::HistogramY &YOut,
                                       HistogramData::HistogramE &EOut) {
-  const size_t bins = lhs.e().size();
+  const auto &lhsY = lhs.y();
+  const auto &lhsE = lhs.e();
+  const size_t bins = lhsE.size();
+  // see comment in the function above for the error formula
   for (size_t j = 0; j < bins; ++j) {
-    // Get reference to input Y
-    const double leftY = lhs.y()[j];
-
-    // see comment in the function above for the error formula
-    EOut[j] = sqrt(pow(lhs.e()[j] * rhsY, 2) + pow(rhsE * leftY, 2));
-
-    // Copy the result last in case one of the input workspaces is also any
-    // output
-    YOut[j] = leftY * rhsY;
+    const double leftError = lhsE[j] * rhsY;
+    const double rightError = rhsE * lhsY[j];
+    EOut[j] = sqrt(leftError * leftError + rightError * rightError);
   }
+  // Values last in case the input workspace is also the output
+  for (size_t j = 0; j < bins; ++j)
+    YOut[j] = lhsY[j] * rhsY;
 }
 
 void Multiply::setOutputUnits(const API::MatrixWorkspace_const_sptr lhs,
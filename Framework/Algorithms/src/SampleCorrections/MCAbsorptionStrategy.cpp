@@ -11,12 +11,93 @@
 
 #include "MantidAlgorithms/SampleCorrections/RectangularBeamProfile.h"
 #include "MantidGeometry/Objects/CSGObject.h"
+#include "MantidGeometry/Objects/Track.h"
+#include "MantidKernel/Material.h"
+#include "MantidKernel/MersenneTwister.h"
+#include "MantidKernel/MultiThreaded.h"
+
+#include <algorithm>
+#include <exception>
+#include <limits>
 
 namespace Mantid {
 using Kernel::PseudoRandomNumberGenerator;
 
 namespace Algorithms {
 
+namespace {
+
+/// The number of events simulated with each stream of random numbers when
+/// the events are shared between wavelengths
+constexpr size_t EVENTS_PER_STREAM = 16;
+
+/// The part of a track inside one object
+struct TrackSegment {
+  /// Index of the attenuation coefficient for the object and wavelength
+  size_t coefficient;
+  /// Length in metres
+  double length;
+};
+
+/// The segments of the tracks of a group of events
+struct EventTracks {
+  /// The materials of the segments
+  std::vector<const Kernel::Material *> materials;
+  /// The segments of every event
+  std::vector<TrackSegment> segments;
+  /// The end of the segments of each event
+  std::vector<size_t> eventEnds;
+};
+
+/**
+ * Add the parts of a track to a list of segments
+ * @param track The track
+ * @param afterScatter True if the track is after the scatter point
+ * @param materials The materials met so far, added to if needed. The
+ * coefficient of a segment is 2 * material index for the wavelength before
+ * scattering and one more for the wavelength after.
+ * @param segments Output, the segments of the track are appended
+ */
+void addSegments(const Geometry::Track &track, const bool afterScatter,
+                 std::vector<const Kernel::Material *> &materials,
+                 std::vector<TrackSegment> &segments) {
+  for (const auto &link : track) {
+    const auto *material = &link.object->material();
+    auto index = static_cast<size_t>(
+        std::find(materials.begin(), materials.end(), material) -
+        materials.begin());
+    if (index == materials.size()) {
+      materials.emplace_back(material);
+    }
+    segments.push_back(
+        {2 * index + (afterScatter ? 1 : 0), link.distInsideObject});
+  }
+}
+
+/**
+ * Compute the attenuation coefficient of a material
+ * @param material The material
+ * @param lambda Wavelength, in \f$\\A\f$
+ * @return The coefficient in \f$m^{-1}\f$
+ */
+double attenuationCoefficient(const Kernel::Material &material,
+                              const double lambda) {
+  return 100 * material.numberDensity() *
+         (material.totalScatterXSection(lambda) +
+          material.absorbXSection(lambda));
+}
+
+/// Report that no valid track was found within the allowed number of attempts
+void throwTooManyAttempts(const size_t maxScatterAttempts) {
+  throw std::runtime_error("Unable to generate valid track through "
+                           "sample interaction volume after " +
+                           std::to_string(maxScatterAttempts) +
+                           " attempts. Try increasing the maximum "
+                           "threshold or if this does not help then "
+                           "please check the defined shape.");
+}
+} // namespace
+
 /**
  * Constructor
  * @param beamProfile A reference to the object the beam profile
@@ -24,16 +105,25 @@ namespace Algorithms {
  * @param nevents The number of Monte Carlo events used in the simulation
  * @param maxScatterPtAttempts The maximum number of tries to generate a random
  * point within the object.
+ * @param targetRelativeError When calculating several wavelengths at once,
+ * add further sets of nevents events until the error relative to the factor
+ * is no more than this at every wavelength. Zero to use nevents events only.
+ * @param maxEvents The largest number of events used to reach the target
+ * error
  */
 MCAbsorptionStrategy::MCAbsorptionStrategy(const IBeamProfile &beamProfile,
                                            const API::Sample &sample,
                                            size_t nevents,
-                                           size_t maxScatterPtAttempts)
+                                           size_t maxScatterPtAttempts,
+                                           double targetRelativeError,
+                                           size_t maxEvents)
     : m_beamProfile(beamProfile),
       m_scatterVol(
           MCInteractionVolume(sample, beamProfile.defineActiveRegion(sample))),
       m_nevents(nevents), m_maxScatterAttempts(maxScatterPtAttempts),
-      m_error(1.0 / std::sqrt(m_nevents)) {}
+      m_error(1.0 / std::sqrt(m_nevents)),
+      m_targetRelativeError(targetRelativeError),
+      m_maxEvents(std::max(nevents, maxEvents)) {}
 
 /**
  * Compute the correction for a final position of the neutron and wavelengths
@@ -65,12 +155,7 @@ MCAbsorptionStrategy::calculate(Kernel::PseudoRandomNumberGenerator &rng,
         break;
       }
       if (attempts == m_maxScatterAttempts) {
-        throw std::runtime_error("Unable to generate valid track through "
-                                 "sample interaction volume after " +
-                                 std::to_string(m_maxScatterAttempts) +
-                                 " attempts. Try increasing the maximum "
-                                 "threshold or if this does not help then "
-                                 "please check the defined shape.");
+        throwTooManyAttempts(m_maxScatterAttempts);
       }
     } while (true);
   }
@@ -78,5 +163,164 @@ MCAbsorptionStrategy::calculate(Kernel::PseudoRandomNumberGenerator &rng,
   return make_tuple(factor / static_cast<double>(m_nevents), m_error);
 }
 
+/**
+ * Compute the correction for a final position of the neutron at several
+ * wavelengths. The attenuation along a track is separable in wavelength so
+ * each simulated event, a scatter point and the tracks to and from it, is
+ * used for every wavelength rather than simulating new events for each one.
+ * The events are simulated in parallel, in groups with their own random
+ * number generators seeded from rng.
+ * @param rng A reference to a PseudoRandomNumberGenerator
+ * @param finalPos Defines the final position of the neutron, assumed to be
+ * where it is detected
+ * @param lambdasBefore Wavelengths, in \f$\\A\f$, before scattering
+ * @param lambdasAfter Wavelengths, in \f$\\A\f$, after scattering, one for
+ * each in lambdasBefore
+ * @param attenuationFactors Output, the correction factor at each wavelength
+ * @param attenuationFactorErrors Output, the standard error of the mean of
+ * each correction factor
+ */
+void MCAbsorptionStrategy::calculate(
+    Kernel::PseudoRandomNumberGenerator &rng, const Kernel::V3D &finalPos,
+    const std::vector<double> &lambdasBefore,
+    const std::vector<double> &lambdasAfter,
+    std::vector<double> &attenuationFactors,
+    std::vector<double> &attenuationFactorErrors) const {
+  const size_t nlambda = lambdasBefore.size();
+  if (lambdasAfter.size() != nlambda) {
+    throw std::invalid_argument("MCAbsorptionStrategy::calculate - number of "
+                                "wavelengths before and after scattering do "
+                                "not match");
+  }
+  const auto scatterBounds = m_scatterVol.getBoundingBox();
+  std::vector<double> sum(nlambda, 0.0), sumOfSquares(nlambda, 0.0);
+  std::vector<const Kernel::Material *> materials;
+  std::vector<TrackSegment> segments;
+  std::vector<size_t> eventOffsets;
+  const size_t nstreams =
+      (m_nevents + EVENTS_PER_STREAM - 1) / EVENTS_PER_STREAM;
+  std::vector<size_t> seeds(nstreams);
+  std::vector<EventTracks> streamTracks(nstreams);
+  size_t nevents(0);
+  while (true) {
+    // Simulate a set of events, keeping only the path lengths through each
+    // material. Groups of events are simulated in parallel, each with its
+    // own stream of random numbers seeded from rng, so that the results do
+    // not depend on the number of threads.
+    for (auto &seed : seeds) {
+      seed = static_cast<size_t>(
+          rng.nextInt(1, std::numeric_limits<int>::max()));
+    }
+    std::exception_ptr trackError;
+    PARALLEL_FOR_NO_WSP_CHECK()
+    for (int64_t s = 0; s < static_cast<int64_t>(nstreams); ++s) {
+      try {
+        Kernel::MersenneTwister streamRng(seeds[s]);
+        auto &tracks = streamTracks[s];
+        tracks.segments.clear();
+        tracks.eventEnds.clear();
+        Geometry::Track beforeScatter, afterScatter;
+        const size_t first = static_cast<size_t>(s) * EVENTS_PER_STREAM;
+        const size_t last = std::min(first + EVENTS_PER_STREAM, m_nevents);
+        for (size_t i = first; i < last; ++i) {
+          size_t attempts(0);
+          while (true) {
+            const auto neutron =
+                m_beamProfile.generatePoint(streamRng, scatterBounds);
+            if (m_scatterVol.generateTracks(streamRng, neutron.startPos,
+                                            finalPos, beforeScatter,
+                                            afterScatter)) {
+              break;
+            }
+            if (++attempts == m_maxScatterAttempts) {
+              throwTooManyAttempts(m_maxScatterAttempts);
+            }
+          }
+          addSegments(beforeScatter, false, tracks.materials, tracks.segments);
+          addSegments(afterScatter, true, tracks.materials, tracks.segments);
+          tracks.eventEnds.emplace_back(tracks.segments.size());
+        }
+      } catch (...) {
+        PARALLEL_CRITICAL(MCAbsorptionStrategy_calculate) {
+          if (!trackError)
+            trackError = std::current_exception();
+        }
+      }
+    }
+    if (trackError)
+      std::rethrow_exception(trackError);
+
+    // Join the events of all streams, with the coefficients indexing the
+    // materials of all streams
+    eventOffsets.assign(1, 0);
+    segments.clear();
+    for (const auto &tracks : streamTracks) {
+      std::vector<size_t> materialIndices;
+      for (const auto *material : tracks.materials) {
+        const auto index = static_cast<size_t>(
+            std::find(materials.begin(), materials.end(), material) -
+            materials.begin());
+        if (index == materials.size()) {
+          materials.emplace_back(material);
+        }
+        materialIndices.emplace_back(index);
+      }
+      const size_t offset = segments.size();
+      for (const auto &segment : tracks.segments) {
+        segments.push_back({2 * materialIndices[segment.coefficient / 2] +
+                                segment.coefficient % 2,
+                            segment.length});
+      }
+      for (const auto end : tracks.eventEnds) {
+        eventOffsets.emplace_back(offset + end);
+      }
+    }
+    nevents += m_nevents;
+
+    const size_t nmaterials = materials.size();
+    PARALLEL_FOR_NO_WSP_CHECK()
+    for (int64_t j = 0; j < static_cast<int64_t>(nlambda); ++j) {
+      std::vector<double> coefficients(2 * nmaterials);
+      for (size_t k = 0; k < nmaterials; ++k) {
+        coefficients[2 * k] =
+            attenuationCoefficient(*materials[k], lambdasBefore[j]);
+        coefficients[2 * k + 1] =
+            attenuationCoefficient(*materials[k], lambdasAfter[j]);
+      }
+      double setSum(0.0), setSumOfSquares(0.0);
+      for (size_t i = 1; i < eventOffsets.size(); ++i) {
+        double exponent(0.0);
+        for (size_t k = eventOffsets[i - 1]; k < eventOffsets[i]; ++k) {
+          const auto &segment = segments[k];
+          exponent += coefficients[segment.coefficient] * segment.length;
+        }
+        const double factor = std::exp(-exponent);
+        setSum += factor;
+        setSumOfSquares += factor * factor;
+      }
+      sum[j] += setSum;
+      sumOfSquares[j] += setSumOfSquares;
+    }
+
+    attenuationFactors.resize(nlambda);
+    attenuationFactorErrors.resize(nlambda);
+    const auto n = static_cast<double>(nevents);
+    bool converged(true);
+    for (size_t j = 0; j < nlambda; ++j) {
+      const double mean = sum[j] / n;
+      const double variance =
+          nevents > 1
+              ? std::max(0.0, (sumOfSquares[j] - n * mean * mean) / (n - 1))
+              : 0.0;
+      attenuationFactors[j] = mean;
+      attenuationFactorErrors[j] = std::sqrt(variance / n);
+      converged &= attenuationFactorErrors[j] <= m_targetRelativeError * mean;
+    }
+    if (m_targetRelativeError <= 0.0 || converged || nevents >= m_maxEvents) {
+      break;
+    }
+  }
+}
+
 } // namespace Algorithms
 } // namespace Mantid
@@ -87,6 +87,50 @@ const Geometry::BoundingBox &MCInteractionVolume::getBoundingBox() const {
 double MCInteractionVolume::calculateAbsorption(
     Kernel::PseudoRandomNumberGenerator &rng, const Kernel::V3D &startPos,
     const Kernel::V3D &endPos, double lambdaBefore, double lambdaAfter) const {
+  Track beforeScatter, afterScatter;
+  if (!generateTracks(rng, startPos, endPos, beforeScatter, afterScatter)) {
+    return -1.0;
+  }
+
+  // Function to calculate total attenuation for a track
+  auto calculateAttenuation = [](const Track &path, double lambda) {
+    double factor(1.0);
+    for (const auto &segment : path) {
+      const double length = segment.distInsideObject;
+      const auto &segObj = *(segment.object);
+      const auto &segMat = segObj.material();
+      factor *= attenuation(segMat.numberDensity(),
+                            segMat.totalScatterXSection(lambda) +
+                                segMat.absorbXSection(lambda),
+                            length);
+    }
+    return factor;
+  };
+
+  return calculateAttenuation(beforeScatter, lambdaBefore) *
+         calculateAttenuation(afterScatter, lambdaAfter);
+}
+
+/**
+ * Generate a scatter point in the volume and the tracks through the sample
+ * and environment from it back to the start point and on to the end point.
+ * The tracks do not depend on the wavelength so can be reused for any.
+ * @param rng A reference to a PseudoRandomNumberGenerator producing
+ * random number between [0,1]
+ * @param startPos Origin of the initial track
+ * @param endPos Final position of neutron after scattering (assumed to be
+ * outside of the "volume")
+ * @param beforeScatter Output, the track from the scatter point towards the
+ * start point. Any earlier links are cleared.
+ * @param afterScatter Output, the track from the scatter point towards the
+ * end point. Any earlier links are cleared.
+ * @return False if the track before scattering did not intersect anything so
+ * the tracks are not valid
+ */
+bool MCInteractionVolume::generateTracks(
+    Kernel::PseudoRandomNumberGenerator &rng, const Kernel::V3D &startPos,
+    const Kernel::V3D &endPos, Track &beforeScatter,
+    Track &afterScatter) const {
   // Generate scatter point. If there is an environment present then
   // first select whether the scattering occurs on the sample or the
   // environment. The attenuation for the path leading to the scatter point
@@ -102,7 +146,8 @@ double MCInteractionVolume::calculateAbsorption(
                                                  m_maxScatterAttempts);
   }
   const auto toStart = normalize(startPos - scatterPos);
-  Track beforeScatter(scatterPos, toStart);
+  beforeScatter.reset(scatterPos, toStart);
+  beforeScatter.clearIntersectionResults();
   int nlinks = m_sample->interceptSurface(beforeScatter);
   if (m_env) {
     nlinks += m_env->interceptSurfaces(beforeScatter);
@@ -110,33 +155,18 @@ double MCInteractionVolume::calculateAbsorption(
   // This should not happen but numerical precision means that it can
   // occasionally occur with tracks that are very close to the surface
   if (nlinks == 0) {
-    return -1.0;
+    return false;
   }
 
-  // Function to calculate total attenuation for a track
-  auto calculateAttenuation = [](const Track &path, double lambda) {
-    double factor(1.0);
-    for (const auto &segment : path) {
-      const double length = segment.distInsideObject;
-      const auto &segObj = *(segment.object);
-      const auto &segMat = segObj.material();
-      factor *= attenuation(segMat.numberDensity(),
-                            segMat.totalScatterXSection(lambda) +
-                                segMat.absorbXSection(lambda),
-                            length);
-    }
-    return factor;
-  };
-
   // Now track to final destination
   const V3D scatteredDirec = normalize(endPos - scatterPos);
-  Track afterScatter(scatterPos, scatteredDirec);
+  afterScatter.reset(scatterPos, scatteredDirec);
+  afterScatter.clearIntersectionResults();
   m_sample->interceptSurface(afterScatter);
   if (m_env) {
     m_env->interceptSurfaces(afterScatter);
   }
-  return calculateAttenuation(beforeScatter, lambdaBefore) *
-         calculateAttenuation(afterScatter, lambdaAfter);
+  return true;
 }
 
 } // namespace Algorithms
@@ -18,7 +18,11 @@
 #include "MantidKernel/ListValidator.h"
 #include "MantidKernel/UnitFactory.h"
 
+#include <boost/weak_ptr.hpp>
+
 #include <atomic>
+#include <memory>
+#include <mutex>
 
 namespace Mantid {
 namespace Algorithms {
@@ -111,7 +115,7 @@ protected:
 struct GenericShape : public SolidAngleCalculator {
   using SolidAngleCalculator::SolidAngleCalculator;
   double solidAngle(size_t index) const override {
-    return m_detectorInfo.detector(index).solidAngle(m_samplePos);
+    return m_componentInfo.solidAngle(index, m_samplePos);
   }
 };
 
@@ -155,6 +159,35 @@ struct Wing : public SolidAngleCalculator {
   }
 };
 
+/**
+ * The solid angles of the detectors calculated with the generic shape method
+ * along with the geometry they were calculated for.
+ */
+struct SolidAngleTable {
+  /// True if the solid angles in other can be used for this geometry
+  bool sameGeometry(const SolidAngleTable &other) const {
+    const auto instrument = baseInstrument.lock();
+    return instrument && instrument == other.baseInstrument.lock() &&
+           samplePosition == other.samplePosition &&
+           positions == other.positions && rotations == other.rotations &&
+           scaleFactors == other.scaleFactors;
+  }
+  /// The instrument the detector shapes belong to, not kept alive by the
+  /// table
+  boost::weak_ptr<const Instrument> baseInstrument;
+  V3D samplePosition;
+  std::vector<V3D> positions;
+  std::vector<Quat> rotations;
+  std::vector<V3D> scaleFactors;
+  std::vector<char> isCalculated;
+  std::vector<double> solidAngles;
+};
+
+/// The solid angles of the most recent execution using the generic shape. It
+/// is dropped by the next execution once its instrument has been deleted.
+std::shared_ptr<const SolidAngleTable> g_lastSolidAngles;
+std::mutex g_lastSolidAnglesMutex;
+
 } // namespace SolidAngleHelpers
 
 /// Initialisation method
@@ -266,8 +299,66 @@ void SolidAngle::exec() {
         std::make_unique<Wing>(componentInfo, detectorInfo, method, pixelArea);
   }
 
+  // Find the detectors whose solid angle is needed, so that each one is only
+  // calculated once even if it belongs to several spectra
+  const auto numberOfDetectors = static_cast<int64_t>(detectorInfo.size());
+  std::vector<char> isNeeded(detectorInfo.size(), 0);
+  for (int j = m_MinSpec; j <= m_MaxSpec; ++j) {
+    if (!spectrumInfo.hasDetectors(j))
+      continue;
+    for (const auto detID : inputWS->getSpectrum(j).getDetectorIDs()) {
+      const auto index = detectorInfo.indexOf(detID);
+      if (!detectorInfo.isMasked(index) && !detectorInfo.isMonitor(index)) {
+        isNeeded[index] = 1;
+      }
+    }
+  }
+
+  // The generic shape is expensive so reuse the solid angles of the last
+  // execution if the instrument has not changed
+  auto table = std::make_shared<SolidAngleTable>();
+  table->isCalculated.resize(detectorInfo.size(), 0);
+  table->solidAngles.resize(detectorInfo.size(), 0.0);
+  const bool useCache = method == GENERIC_SHAPE && !detectorInfo.isScanning();
+  if (useCache) {
+    table->baseInstrument = inputWS->getInstrument()->baseInstrument();
+    table->samplePosition = detectorInfo.samplePosition();
+    table->positions.reserve(detectorInfo.size());
+    table->rotations.reserve(detectorInfo.size());
+    table->scaleFactors.reserve(detectorInfo.size());
+    for (size_t i = 0; i < detectorInfo.size(); ++i) {
+      table->positions.emplace_back(detectorInfo.position(i));
+      table->rotations.emplace_back(detectorInfo.rotation(i));
+      table->scaleFactors.emplace_back(componentInfo.scaleFactor(i));
+    }
+    std::lock_guard<std::mutex> lock(g_lastSolidAnglesMutex);
+    if (g_lastSolidAngles && g_lastSolidAngles->sameGeometry(*table)) {
+      table->isCalculated = g_lastSolidAngles->isCalculated;
+      table->solidAngles = g_lastSolidAngles->solidAngles;
+    } else {
+      g_lastSolidAngles.reset();
+    }
+  }
+
+  Progress prog(this, 0.0, 1.0, numberOfDetectors + numberOfSpectra);
+  PARALLEL_FOR_IF(Kernel::threadSafe(*inputWS))
+  for (int64_t i = 0; i < numberOfDetectors; ++i) {
+    PARALLEL_START_INTERUPT_REGION
+    if (isNeeded[i] && !table->isCalculated[i]) {
+      table->solidAngles[i] = solidAngleCalculator->solidAngle(i);
+      table->isCalculated[i] = 1;
+    }
+    prog.report();
+    PARALLEL_END_INTERUPT_REGION
+  }
+  PARALLEL_CHECK_INTERUPT_REGION
+
+  if (useCache) {
+    std::lock_guard<std::mutex> lock(g_lastSolidAnglesMutex);
+    g_lastSolidAngles = table;
+  }
+
   std::atomic<size_t> failCount{0};
-  Progress prog(this, 0.0, 1.0, numberOfSpectra);
   // Loop over the histograms (detector spectra)
   PARALLEL_FOR_IF(Kernel::threadSafe(*outputWS, *inputWS))
   for (int j = m_MinSpec; j <= m_MaxSpec; ++j) {
@@ -277,8 +368,8 @@ void SolidAngle::exec() {
       double solidAngle = 0.0;
       for (const auto detID : inputWS->getSpectrum(j).getDetectorIDs()) {
         const auto index = detectorInfo.indexOf(detID);
-        if (!detectorInfo.isMasked(index) && !detectorInfo.isMonitor(index)) {
-          solidAngle += solidAngleCalculator->solidAngle(index);
+        if (isNeeded[index]) {
+          solidAngle += table->solidAngles[index];
         }
       }
       outputWS->mutableY(j)[0] = solidAngle;
@@ -12,6 +12,10 @@
 #include "MantidAPI/CommonBinsValidator.h"
 #include "MantidAPI/NumericAxis.h"
 #include "MantidDataObjects/RebinnedOutput.h"
+#include "MantidDataObjects/Workspace2D.h"
+
+#include <algorithm>
+#include <array>
 
 namespace Mantid {
 namespace Algorithms {
@@ -22,6 +26,11 @@ DECLARE_ALGORITHM(Transpose)
 using namespace Kernel;
 using namespace API;
 
+namespace {
+/// The number of output spectra filled together: one cache line of doubles
+constexpr size_t BLOCK_SIZE = 8;
+} // namespace
+
 void Transpose::init() {
   declareProperty(std::make_unique<WorkspaceProperty<>>(
                       "InputWorkspace", "", Direction::Input,
@@ -56,36 +65,60 @@ void Transpose::exec() {
   auto newXVector =
       Kernel::make_cow<HistogramData::HistogramX>(std::move(newXValues));
 
-  Progress progress(this, 0.0, 1.0, newNhist * newYsize);
+  // Workspace2D inputs are read through views of all their spectra, which
+  // avoids going through the workspace for every input spectrum
+  const auto input2D =
+      boost::dynamic_pointer_cast<const DataObjects::Workspace2D>(
+          inputWorkspace);
+  DataObjects::SpectraView<const double> inY, inE;
+  if (input2D) {
+    inY = input2D->yView();
+    inE = input2D->eView();
+  }
+
+  // Output spectra are filled in blocks, so that the values read from each
+  // input spectrum are neighbours in memory
+  const size_t numberOfBlocks = (newNhist + BLOCK_SIZE - 1) / BLOCK_SIZE;
+  Progress progress(this, 0.0, 1.0, numberOfBlocks);
   progress.report("Swapping data values");
   PARALLEL_FOR_IF(Kernel::threadSafe(*inputWorkspace, *outputWorkspace))
-  for (int64_t i = 0; i < static_cast<int64_t>(newNhist); ++i) {
+  for (int64_t block = 0; block < static_cast<int64_t>(numberOfBlocks);
+       ++block) {
     PARALLEL_START_INTERUPT_REGION
 
-    outputWorkspace->setSharedX(i, newXVector);
-
-    auto &outY = outputWorkspace->mutableY(i);
-    auto &outE = outputWorkspace->mutableE(i);
-
+    const size_t begin = static_cast<size_t>(block) * BLOCK_SIZE;
+    const size_t end = std::min(begin + BLOCK_SIZE, newNhist);
+    std::array<double *, BLOCK_SIZE> outY, outE;
     // because setF wants a COW pointer
-    Kernel::cow_ptr<std::vector<double>> F;
-    std::vector<double> &outF = F.access();
-
-    if (outRebinWorkspace) {
-      outF.resize(newYsize);
+    std::array<Kernel::cow_ptr<std::vector<double>>, BLOCK_SIZE> F;
+    for (size_t i = begin; i < end; ++i) {
+      outputWorkspace->setSharedX(i, newXVector);
+      outY[i - begin] = outputWorkspace->mutableY(i).mutableRawData().data();
+      outE[i - begin] = outputWorkspace->mutableE(i).mutableRawData().data();
+      if (outRebinWorkspace)
+        F[i - begin].access().resize(newYsize);
     }
 
-    for (int64_t j = 0; j < int64_t(newYsize); ++j) {
-      progress.report();
-      outY[j] = inputWorkspace->y(j)[i];
-      outE[j] = inputWorkspace->e(j)[i];
+    for (size_t j = 0; j < newYsize; ++j) {
+      const double *inYRow =
+          input2D ? inY.row(j) : inputWorkspace->y(j).rawData().data();
+      const double *inERow =
+          input2D ? inE.row(j) : inputWorkspace->e(j).rawData().data();
+      for (size_t i = begin; i < end; ++i) {
+        outY[i - begin][j] = inYRow[i];
+        outE[i - begin][j] = inERow[i];
+      }
       if (outRebinWorkspace) {
-        outF[j] = inRebinWorkspace->dataF(j)[i];
+        const auto &inF = inRebinWorkspace->dataF(j);
+        for (size_t i = begin; i < end; ++i)
+          F[i - begin].access()[j] = inF[i];
       }
     }
     if (outRebinWorkspace) {
-      outRebinWorkspace->setF(i, F);
+      for (size_t i = begin; i < end; ++i)
+        outRebinWorkspace->setF(i, F[i - begin]);
     }
+    progress.report();
 
     PARALLEL_END_INTERUPT_REGION
   }
@@ -294,6 +294,32 @@ public:
     Mantid::API::AnalysisDataService::Instance().remove(outputWS);
   }
 
+  void testRepeatedExecutionWithDifferentMaterials() {
+    // The second and third executions reuse the path lengths of the first
+    const std::string outputWS("factors");
+    std::vector<std::vector<double>> factors;
+    for (const auto &xSection : {"5.08", "2.5", "5.08"}) {
+      MatrixWorkspace_sptr testWS = createTestWorkspace();
+      Mantid::Algorithms::CylinderAbsorption atten;
+      configureAbsCommon(atten, testWS, outputWS);
+      configureAbsSample(atten);
+      TS_ASSERT_THROWS_NOTHING(
+          atten.setPropertyValue("AttenuationXSection", xSection));
+      TS_ASSERT_THROWS_NOTHING(atten.execute());
+      TS_ASSERT(atten.isExecuted());
+
+      auto result = boost::dynamic_pointer_cast<Mantid::API::MatrixWorkspace>(
+          Mantid::API::AnalysisDataService::Instance().retrieve(outputWS));
+      factors.emplace_back(result->readY(0));
+    }
+    TS_ASSERT_DELTA(factors[0].front(), 0.7210, 0.0001);
+    TS_ASSERT_DELTA(factors[0].back(), 0.2052, 0.0001);
+    TS_ASSERT_EQUALS(factors[0], factors[2]);
+    TS_ASSERT_LESS_THAN(factors[0].back(), factors[1].back());
+
+    Mantid::API::AnalysisDataService::Instance().remove(outputWS);
+  }
+
 private:
   MatrixWorkspace_sptr createTestWorkspace() {
     // Create a small test workspace
@@ -10,12 +10,15 @@
 #include "MantidAPI/FrameworkManager.h"
 #include "MantidAPI/SpectraAxis.h"
 #include "MantidAlgorithms/AlignDetectors.h"
+#include "MantidAlgorithms/ConvertToMatrixWorkspace.h"
+#include "MantidAlgorithms/CreateGroupingWorkspace.h"
 #include "MantidAlgorithms/DiffractionFocussing2.h"
 #include "MantidAlgorithms/MaskBins.h"
 #include "MantidAlgorithms/Rebin.h"
 #include "MantidDataHandling/LoadNexus.h"
 #include "MantidDataHandling/LoadRaw3.h"
 #include "MantidDataObjects/EventWorkspace.h"
+#include "MantidDataObjects/GroupingWorkspace.h"
 #include "MantidHistogramData/LinearGenerator.h"
 #include "MantidKernel/UnitFactory.h"
 #include "MantidKernel/cow_ptr.h"
@@ -102,6 +105,51 @@ public:
     dotestEventWorkspace(false, 1, false);
   }
 
+  void test_EventWorkspace_dontPreserveEvents_matches_histogram_input() {
+    // Without preserving events the histogram of each spectrum on its input
+    // binning is rebinned, as for a Workspace2D, so both must give the same
+    // values even where an input bin straddles an output bin edge.
+    EventWorkspace_sptr input =
+        WorkspaceCreationHelper::createEventWorkspaceWithFullInstrument(2, 4);
+    input->getAxis(0)->unit() = UnitFactory::Instance().create("dSpacing");
+    // The output bin edges are 100, 169.3, 286.7 and 485.4
+    const std::vector<std::pair<double, double>> eventBins{
+        {110., 200.}, {150., 300.}, {250., 480.}};
+    for (size_t pix = 0; pix < input->getNumberHistograms(); ++pix) {
+      const auto &bin = eventBins[pix % 3];
+      input->setHistogram(pix, BinEdges{100., bin.first, bin.second, 800.});
+      auto &events = input->getSpectrum(pix);
+      events.switchTo(WEIGHTED);
+      const double weight = 1.0 + 0.5 * static_cast<double>(pix % 2);
+      for (size_t i = 0; i <= pix % 5; ++i) {
+        const double tof = bin.first + (bin.second - bin.first) *
+                                           (static_cast<double>(i) + 0.5) / 5.;
+        events.addEventQuickly(
+            WeightedEvent(TofEvent(tof), weight, 2.0 * weight));
+      }
+    }
+
+    ConvertToMatrixWorkspace convert;
+    convert.initialize();
+    convert.setChild(true);
+    convert.setProperty("InputWorkspace", input);
+    convert.setPropertyValue("OutputWorkspace", "histograms");
+    convert.execute();
+    MatrixWorkspace_sptr histograms = convert.getProperty("OutputWorkspace");
+
+    const auto focused = focusBanks(input);
+    const auto expected = focusBanks(histograms);
+    TS_ASSERT(!boost::dynamic_pointer_cast<const EventWorkspace>(focused));
+    TS_ASSERT_EQUALS(focused->getNumberHistograms(), 2);
+    TS_ASSERT_EQUALS(expected->getNumberHistograms(), 2);
+    for (size_t i = 0; i < 2; ++i) {
+      TS_ASSERT_EQUALS(focused->x(i).rawData(), expected->x(i).rawData());
+      TS_ASSERT_DIFFERS(focused->y(i)[1], 0.0);
+      TS_ASSERT_EQUALS(focused->y(i).rawData(), expected->y(i).rawData());
+      TS_ASSERT_EQUALS(focused->e(i).rawData(), expected->e(i).rawData());
+    }
+  }
+
   void dotestEventWorkspace(bool inplace, size_t numgroups,
                             bool preserveEvents = true,
                             int bankWidthInPixels = 16) {
@@ -245,6 +293,28 @@ public:
   }
 
 private:
+  /// Focus bank1 and bank2 into two spectra without preserving events
+  MatrixWorkspace_sptr focusBanks(const MatrixWorkspace_sptr &input) {
+    CreateGroupingWorkspace grouping;
+    grouping.initialize();
+    grouping.setChild(true);
+    grouping.setProperty("InputWorkspace", input);
+    grouping.setPropertyValue("GroupNames", "bank1,bank2");
+    grouping.setPropertyValue("OutputWorkspace", "grouping");
+    grouping.execute();
+    GroupingWorkspace_sptr groupingWS = grouping.getProperty("OutputWorkspace");
+
+    DiffractionFocussing2 focussing;
+    focussing.initialize();
+    focussing.setChild(true);
+    focussing.setProperty("InputWorkspace", input);
+    focussing.setProperty("GroupingWorkspace", groupingWS);
+    focussing.setProperty("PreserveEvents", false);
+    focussing.setPropertyValue("OutputWorkspace", "focused");
+    TS_ASSERT_THROWS_NOTHING(focussing.execute());
+    return focussing.getProperty("OutputWorkspace");
+  }
+
   DiffractionFocussing2 focus;
 };
 
@@ -13,6 +13,8 @@
 #include "MantidAlgorithms/SampleCorrections/RectangularBeamProfile.h"
 #include "MantidGeometry/Instrument/ReferenceFrame.h"
 #include "MantidGeometry/Objects/BoundingBox.h"
+#include "MantidKernel/MersenneTwister.h"
+#include "MantidKernel/MultiThreaded.h"
 #include "MantidKernel/WarningSuppressions.h"
 #include "MonteCarloTesting.h"
 
@@ -63,6 +65,96 @@ public:
     TS_ASSERT_DELTA(1.0 / std::sqrt(nevents), error, 1e-08);
   }
 
+  void test_Simulation_Shares_Events_Between_Wavelengths() {
+    using Mantid::Kernel::V3D;
+    using namespace MonteCarloTesting;
+    using namespace ::testing;
+
+    auto testSampleSphere = MonteCarloTesting::createTestSample(
+        MonteCarloTesting::TestSampleType::SolidSphere);
+    MockBeamProfile testBeamProfile;
+    EXPECT_CALL(testBeamProfile, defineActiveRegion(_))
+        .WillOnce(Return(testSampleSphere.getShape().getBoundingBox()));
+    const size_t nevents(40), maxTries(100);
+    MCAbsorptionStrategy mcabsorb(testBeamProfile, testSampleSphere, nevents,
+                                  maxTries);
+    // One seed per group of 16 events, however many wavelengths
+    MockRNG rng;
+    EXPECT_CALL(rng, nextInt(_, _))
+        .Times(Exactly(3))
+        .WillRepeatedly(Return(12345));
+    const Mantid::Algorithms::IBeamProfile::Ray testRay = {V3D(-2, 0, 0),
+                                                           V3D(1, 0, 0)};
+    EXPECT_CALL(testBeamProfile, generatePoint(_, _))
+        .Times(Exactly(static_cast<int>(nevents)))
+        .WillRepeatedly(Return(testRay));
+    const V3D endPos(0.7, 0.7, 1.4);
+    const std::vector<double> lambdasBefore = {2.5, 2.5, 1.0};
+    const std::vector<double> lambdasAfter = {3.5, 3.5, 1.0};
+
+    std::vector<double> factors, errors;
+    mcabsorb.calculate(rng, endPos, lambdasBefore, lambdasAfter, factors,
+                       errors);
+    TS_ASSERT_EQUALS(factors.size(), 3);
+    TS_ASSERT_EQUALS(errors.size(), 3);
+    // The same events give the same factor for the same wavelengths
+    TS_ASSERT_EQUALS(factors[0], factors[1]);
+    TS_ASSERT_EQUALS(errors[0], errors[1]);
+    TS_ASSERT_LESS_THAN(0.0, factors[0]);
+    TS_ASSERT_LESS_THAN(0.0, errors[0]);
+    // Less absorption at shorter wavelengths
+    TS_ASSERT_LESS_THAN(factors[0], factors[2]);
+  }
+
+  void test_Shared_Events_Do_Not_Depend_On_Number_Of_Threads() {
+    using Mantid::Algorithms::RectangularBeamProfile;
+    using namespace Mantid::Geometry;
+    using namespace Mantid::Kernel;
+
+    auto testSampleSphere = MonteCarloTesting::createTestSample(
+        MonteCarloTesting::TestSampleType::SolidSphere);
+    RectangularBeamProfile testBeamProfile(
+        ReferenceFrame(Y, Z, Right, "source"), V3D(), 1, 1);
+    MCAbsorptionStrategy mcabs(testBeamProfile, testSampleSphere, 100, 100);
+    const V3D endPos(0.7, 0.7, 1.4);
+    const std::vector<double> lambdasBefore = {1.0, 2.5};
+    const std::vector<double> lambdasAfter = {1.0, 3.5};
+
+    std::vector<double> factors, errors;
+    MersenneTwister rng(1234);
+    mcabs.calculate(rng, endPos, lambdasBefore, lambdasAfter, factors, errors);
+
+    const int numThreads = PARALLEL_GET_MAX_THREADS;
+    PARALLEL_SET_NUM_THREADS(1);
+    std::vector<double> serialFactors, serialErrors;
+    MersenneTwister serialRng(1234);
+    mcabs.calculate(serialRng, endPos, lambdasBefore, lambdasAfter,
+                    serialFactors, serialErrors);
+    PARALLEL_SET_NUM_THREADS(numThreads);
+
+    TS_ASSERT_EQUALS(factors, serialFactors);
+    TS_ASSERT_EQUALS(errors, serialErrors);
+  }
+
+  void test_Simulation_Throws_If_Wavelength_Lists_Differ() {
+    using Mantid::Algorithms::RectangularBeamProfile;
+    using namespace Mantid::Geometry;
+    using namespace Mantid::Kernel;
+    using namespace MonteCarloTesting;
+    using namespace ::testing;
+
+    auto testSampleSphere = MonteCarloTesting::createTestSample(
+        MonteCarloTesting::TestSampleType::SolidSphere);
+    RectangularBeamProfile testBeamProfile(
+        ReferenceFrame(Y, Z, Right, "source"), V3D(), 1, 1);
+    MCAbsorptionStrategy mcabs(testBeamProfile, testSampleSphere, 10, 100);
+    MockRNG rng;
+    std::vector<double> factors, errors;
+    TS_ASSERT_THROWS(mcabs.calculate(rng, V3D(0.7, 0.7, 1.4), {2.5, 3.0},
+                                     {3.5}, factors, errors),
+                     const std::invalid_argument &)
+  }
+
   //----------------------------------------------------------------------------
   // Failure cases
   //----------------------------------------------------------------------------
@@ -327,6 +327,51 @@ public:
     TS_ASSERT_DELTA(0.1385715148, outputWS->y(0).back(), delta);
   }
 
+  void test_Tracks_Shared_Between_Wavelengths() {
+    using Mantid::Kernel::DeltaEMode;
+    TestWorkspaceDescriptor wsProps = {
+        5, 10, Environment::SampleOnly, DeltaEMode::Elastic, -1, -1};
+    auto mcabs = createAlgorithm();
+    mcabs->setProperty("InputWorkspace", setUpWS(wsProps));
+    mcabs->setProperty("ResimulateTracksForDifferentWavelengths", false);
+    TS_ASSERT_THROWS_NOTHING(mcabs->execute());
+    auto outputWS = getOutputWorkspace(mcabs);
+
+    verifyDimensions(wsProps, outputWS);
+    // Statistically consistent with the values simulated per wavelength
+    const double delta(0.04);
+    const size_t middle_index(4);
+    TS_ASSERT_DELTA(0.6245262704, outputWS->y(0).front(), delta);
+    TS_ASSERT_DELTA(0.2770105008, outputWS->y(0)[middle_index], delta);
+    TS_ASSERT_DELTA(0.1041517761, outputWS->y(0).back(), delta);
+    // The same events are used for every wavelength so the attenuation
+    // increases strictly with wavelength
+    for (size_t i = 0; i < outputWS->getNumberHistograms(); ++i) {
+      const auto &y = outputWS->y(i);
+      for (size_t j = 1; j < y.size(); ++j) {
+        TS_ASSERT_LESS_THAN(y[j], y[j - 1]);
+      }
+    }
+  }
+
+  void test_Target_Relative_Error_With_Shared_Tracks() {
+    using Mantid::Kernel::DeltaEMode;
+    TestWorkspaceDescriptor wsProps = {
+        1, 10, Environment::SampleOnly, DeltaEMode::Elastic, -1, -1};
+    auto mcabs = createAlgorithm();
+    mcabs->setProperty("InputWorkspace", setUpWS(wsProps));
+    mcabs->setProperty("ResimulateTracksForDifferentWavelengths", false);
+    mcabs->setProperty("EventsPerPoint", 100);
+    mcabs->setProperty("TargetRelativeError", 0.01);
+    mcabs->setProperty("MaxEventsPerPoint", 20000);
+    TS_ASSERT_THROWS_NOTHING(mcabs->execute());
+    auto outputWS = getOutputWorkspace(mcabs);
+
+    verifyDimensions(wsProps, outputWS);
+    TS_ASSERT_DELTA(0.6245262704, outputWS->y(0).front(), 0.04);
+    TS_ASSERT_DELTA(0.1041517761, outputWS->y(0).back(), 0.015);
+  }
+
 private:
   Mantid::API::MatrixWorkspace_const_sptr
   runAlgorithm(const TestWorkspaceDescriptor &wsProps, int nlambda = -1,
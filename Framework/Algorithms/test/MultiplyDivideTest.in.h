@@ -136,7 +136,32 @@ public:
     performTest(work_in1,work_in2, false /*not event*/,
         DO_DIVIDE ? 1.0 : 4.0, DO_DIVIDE ? 1.0 : 4.0, false, false, true /*in place*/);
   }
-    
+
+  void test_2D_2D_errors_use_original_values()
+  {
+    int nHist = 3,nBins=4;
+    for (int inplace=0; inplace<2; inplace++)
+    {
+      MatrixWorkspace_sptr work_in2 = WorkspaceCreationHelper::create2DWorkspace(nHist,nBins);
+      for (int i = 0; i < nHist; i++)
+        for (int j = 0; j < nBins; j++)
+        {
+          work_in2->mutableY(i)[j] = 2.0 + 0.5*j;
+          work_in2->mutableE(i)[j] = 0.1*(i+1);
+        }
+      doErrorsUseOriginalValuesTest(work_in2, inplace!=0);
+    }
+  }
+
+  void test_2D_SingleValue_errors_use_original_values()
+  {
+    for (int inplace=0; inplace<2; inplace++)
+    {
+      MatrixWorkspace_sptr work_in2 = WorkspaceCreationHelper::createWorkspaceSingleValueWithError(2.5, 0.3);
+      doErrorsUseOriginalValuesTest(work_in2, inplace!=0);
+    }
+  }
+
   void test_2D_1D_different_spectrum_number()
   {
     if(DO_DIVIDE)
@@ -996,6 +1021,54 @@ public:
     if( !replaceInput ) AnalysisDataService::Instance().remove(outputSpace);
   }
 
+  /// Values and errors vary per bin, so errors computed from already
+  /// overwritten lhs values would come out wrong when operating in place
+  void doErrorsUseOriginalValuesTest(MatrixWorkspace_sptr work_in2, bool inplace)
+  {
+    const int nHist = 3,nBins=4;
+    MatrixWorkspace_sptr work_in1 = WorkspaceCreationHelper::create2DWorkspace(nHist,nBins);
+    for (int i = 0; i < nHist; i++)
+      for (int j = 0; j < nBins; j++)
+      {
+        work_in1->mutableY(i)[j] = 1.0 + i + j;
+        work_in1->mutableE(i)[j] = 0.5 + 0.25*j;
+      }
+    MatrixWorkspace_const_sptr original = work_in1->clone();
+
+    IAlgorithm_sptr alg;
+    if (DO_DIVIDE)
+      alg = boost::make_shared<Divide>();
+    else
+      alg = boost::make_shared<Multiply>();
+    alg->initialize();
+    alg->setChild(true);
+    alg->setProperty("LHSWorkspace", work_in1);
+    alg->setProperty("RHSWorkspace", work_in2);
+    if (inplace)
+      alg->setProperty("OutputWorkspace", work_in1);
+    else
+      alg->setPropertyValue("OutputWorkspace", "dummy");
+    TS_ASSERT_THROWS_NOTHING(alg->execute());
+    MatrixWorkspace_sptr work_out = alg->getProperty("OutputWorkspace");
+    TS_ASSERT_EQUALS(work_out == work_in1, inplace);
+
+    const bool singleValue = work_in2->getNumberHistograms() == 1 && work_in2->blocksize() == 1;
+    for (int i = 0; i < nHist; i++)
+      for (int j = 0; j < nBins; j++)
+      {
+        const double a = original->y(i)[j], ea = original->e(i)[j];
+        const double b = singleValue ? work_in2->y(0)[0] : work_in2->y(i)[j];
+        const double eb = singleValue ? work_in2->e(0)[0] : work_in2->e(i)[j];
+        const double y = DO_DIVIDE ? a / b : a * b;
+        const double e = DO_DIVIDE ? y * std::sqrt(std::pow(ea/a, 2) + std::pow(eb/b, 2))
+                                   : std::sqrt(std::pow(ea*b, 2) + std::pow(eb*a, 2));
+        TS_ASSERT_DELTA(work_out->y(i)[j], y, 1e-10);
+        TS_ASSERT_DELTA(work_out->e(i)[j], e, 1e-10);
+        // The input is only modified when it is also the output
+        TS_ASSERT_EQUALS(work_in1->y(i)[j], inplace ? work_out->y(i)[j] : a);
+      }
+  }
+
 };
 
 //============================================================================
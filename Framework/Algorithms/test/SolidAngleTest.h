@@ -18,6 +18,7 @@
 #include "MantidAlgorithms/SolidAngle.h"
 #include "MantidDataHandling/LoadInstrument.h"
 #include "MantidDataObjects/Workspace2D.h"
+#include "MantidGeometry/Instrument.h"
 #include "MantidKernel/OptionalBool.h"
 #include "MantidKernel/PhysicalConstants.h"
 #include "MantidKernel/Unit.h"
@@ -220,7 +221,54 @@ public:
     }
   }
 
+  void testRepeatedExecutionAfterMovingDetector() {
+    MatrixWorkspace_sptr input =
+        AnalysisDataService::Instance().retrieveWS<MatrixWorkspace>(
+            inputSpace);
+    const auto first = runSolidAngle(input);
+    // Unchanged geometry reuses the solid angles of the first execution
+    const auto second = runSolidAngle(input);
+    for (size_t i = 0; i < first->getNumberHistograms(); ++i) {
+      TS_ASSERT_EQUALS(first->y(i)[0], second->y(i)[0]);
+    }
+
+    // Moving a detector twice as far away must not reuse its old value
+    MatrixWorkspace_sptr moved = input->clone();
+    auto &detectorInfo = moved->mutableDetectorInfo();
+    const auto index = detectorInfo.indexOf(
+        *moved->getSpectrum(5).getDetectorIDs().begin());
+    const auto samplePos = detectorInfo.samplePosition();
+    detectorInfo.setPosition(
+        index, samplePos + (detectorInfo.position(index) - samplePos) * 2.0);
+    const auto third = runSolidAngle(moved);
+    TS_ASSERT_DELTA(third->y(5)[0], 0.25 * first->y(5)[0], 0.00001);
+    TS_ASSERT_EQUALS(third->y(10)[0], first->y(10)[0]);
+  }
+
+  void testKeptSolidAnglesDoNotKeepInstrumentAlive() {
+    MatrixWorkspace_sptr input =
+        WorkspaceCreationHelper::create2DWorkspaceWithFullInstrument(3, 1);
+    boost::weak_ptr<const Instrument> instrument =
+        input->getInstrument()->baseInstrument();
+    auto output = runSolidAngle(input);
+    TS_ASSERT_LESS_THAN(0.0, output->y(0)[0]);
+    input.reset();
+    output.reset();
+    TS_ASSERT(instrument.expired());
+  }
+
 private:
+  MatrixWorkspace_sptr runSolidAngle(const MatrixWorkspace_sptr &input) {
+    SolidAngle alg;
+    alg.setChild(true);
+    alg.initialize();
+    alg.setProperty("InputWorkspace", input);
+    alg.setPropertyValue("OutputWorkspace", "unused");
+    TS_ASSERT_THROWS_NOTHING(alg.execute());
+    TS_ASSERT(alg.isExecuted());
+    return alg.getProperty("OutputWorkspace");
+  }
+
   std::string inputSpace;
   std::string outputSpace;
   enum { Nhist = 144 };
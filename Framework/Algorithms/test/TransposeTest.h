@@ -141,6 +141,37 @@ public:
     delete transpose;
   }
 
+  void testExec_moves_every_value() {
+    // 19 output spectra, which is not a whole number of blocks
+    const size_t nHist(5), nBins(19);
+    auto inputWS = WorkspaceCreationHelper::create2DWorkspaceBinned(
+        static_cast<int>(nHist), static_cast<int>(nBins));
+    for (size_t i = 0; i < nHist; ++i) {
+      auto &y = inputWS->mutableY(i);
+      auto &e = inputWS->mutableE(i);
+      for (size_t j = 0; j < nBins; ++j) {
+        y[j] = static_cast<double>(100 * i + j);
+        e[j] = static_cast<double>(1000 * i + j);
+      }
+    }
+
+    Transpose alg;
+    alg.setChild(true);
+    alg.initialize();
+    alg.setProperty("InputWorkspace", inputWS);
+    alg.setPropertyValue("OutputWorkspace", "unused_for_child");
+    TS_ASSERT_THROWS_NOTHING(alg.execute());
+    MatrixWorkspace_sptr outputWS = alg.getProperty("OutputWorkspace");
+    TS_ASSERT_EQUALS(outputWS->getNumberHistograms(), nBins);
+    TS_ASSERT_EQUALS(outputWS->blocksize(), nHist);
+    for (size_t j = 0; j < nBins; ++j) {
+      for (size_t i = 0; i < nHist; ++i) {
+        TS_ASSERT_EQUALS(outputWS->y(j)[i], static_cast<double>(100 * i + j));
+        TS_ASSERT_EQUALS(outputWS->e(j)[i], static_cast<double>(1000 * i + j));
+      }
+    }
+  }
+
 private:
   Transpose *transpose;
 };
@@ -11,6 +11,7 @@
 #include "MantidAPI/Progress.h"
 #include "MantidDataHandling/LoadGeometry.h"
 #include "MantidGeometry/Instrument.h"
+#include "MantidGeometry/Instrument/InstrumentCache.h"
 #include "MantidGeometry/Instrument/InstrumentDefinitionParser.h"
 #include "MantidKernel/ArrayProperty.h"
 #include "MantidKernel/ConfigService.h"
@@ -199,9 +200,17 @@ void LoadInstrument::exec() {
     } else {
 
       if (loader_type < LoaderType::Nxs) {
-        // Really create the instrument
-        Progress prog(this, 0.0, 1.0, 100);
-        instrument = parser.parseXML(&prog);
+        // Rebuild the instrument from the on-disk cache if possible, otherwise
+        // really create it and store it in the cache for later processes
+        InstrumentCache cache(instrumentNameMangled);
+        instrument = cache.load();
+        if (instrument) {
+          instrument->setFilename(filename);
+        } else {
+          Progress prog(this, 0.0, 1.0, 100);
+          instrument = parser.parseXML(&prog);
+          cache.save(*instrument);
+        }
         // Parse the instrument tree (internally create ComponentInfo and
         // DetectorInfo). This is an optimization that avoids duplicate parsing
         // of the instrument tree when loading multiple workspaces with the same
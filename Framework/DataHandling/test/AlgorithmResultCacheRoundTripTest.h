@@ -0,0 +1,155 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2019 ISIS Rutherford Appleton Laboratory UKRI,
+//     NScD Oak Ridge National Laboratory, European Spallation Source
+//     & Institut Laue - Langevin
+// SPDX - License - Identifier: GPL - 3.0 +
+#ifndef MANTID_DATAHANDLING_ALGORITHMRESULTCACHEROUNDTRIPTEST_H_
+#define MANTID_DATAHANDLING_ALGORITHMRESULTCACHEROUNDTRIPTEST_H_
+
+#include <cxxtest/TestSuite.h>
+
+#include "MantidAPI/Algorithm.h"
+#include "MantidAPI/FrameworkManager.h"
+#include "MantidAPI/MatrixWorkspace.h"
+#include "MantidAPI/WorkspaceFactory.h"
+#include "MantidAPI/WorkspaceProperty.h"
+#include "MantidKernel/ConfigService.h"
+#include "MantidTestHelpers/WorkspaceCreationHelper.h"
+
+#include <Poco/File.h>
+#include <Poco/Path.h>
+
+using namespace Mantid::API;
+using Mantid::Kernel::ConfigService;
+using Mantid::Kernel::Direction;
+
+namespace {
+/// Scales its input, counting how many times it is really executed
+class ResultCacheTestAlgorithm : public Algorithm {
+public:
+  const std::string name() const override { return "ResultCacheTestAlgorithm"; }
+  int version() const override { return 1; }
+  const std::string category() const override { return "Test"; }
+  const std::string summary() const override { return "Test"; }
+
+  static int executions;
+
+private:
+  void init() override {
+    declareProperty(std::make_unique<WorkspaceProperty<MatrixWorkspace>>(
+        "InputWorkspace", "", Direction::Input));
+    declareProperty("Factor", 1.0);
+    declareProperty(std::make_unique<WorkspaceProperty<MatrixWorkspace>>(
+        "OutputWorkspace", "", Direction::Output));
+  }
+  void exec() override {
+    ++executions;
+    MatrixWorkspace_const_sptr input = getProperty("InputWorkspace");
+    const double factor = getProperty("Factor");
+    auto output = WorkspaceFactory::Instance().create(input);
+    for (size_t i = 0; i < input->getNumberHistograms(); ++i) {
+      output->setSharedX(i, input->sharedX(i));
+      output->mutableY(i) = input->y(i) * factor;
+      output->mutableE(i) = input->e(i) * factor;
+    }
+    setProperty("OutputWorkspace", output);
+  }
+};
+int ResultCacheTestAlgorithm::executions = 0;
+} // namespace
+
+class AlgorithmResultCacheRoundTripTest : public CxxTest::TestSuite {
+public:
+  // This pair of boilerplate methods prevent the suite being created statically
+  // This means the constructor isn't called when running other tests
+  static AlgorithmResultCacheRoundTripTest *createSuite() {
+    return new AlgorithmResultCacheRoundTripTest();
+  }
+  static void destroySuite(AlgorithmResultCacheRoundTripTest *suite) {
+    delete suite;
+  }
+
+  AlgorithmResultCacheRoundTripTest()
+      : m_directory(Poco::Path::temp() + "AlgorithmResultCacheRoundTripTest") {
+    FrameworkManager::Instance();
+  }
+
+  void setUp() override {
+    auto &config = ConfigService::Instance();
+    config.setString("algorithms.resultcache.directory", m_directory);
+    config.setString("algorithms.resultcache.algorithms",
+                     "ResultCacheTestAlgorithm");
+    ResultCacheTestAlgorithm::executions = 0;
+  }
+
+  void tearDown() override {
+    auto &config = ConfigService::Instance();
+    config.setString("algorithms.resultcache.directory", "");
+    config.setString("algorithms.resultcache.algorithms", "");
+    Poco::File directory(m_directory);
+    if (directory.exists())
+      directory.remove(true);
+  }
+
+  void test_second_execution_is_read_from_the_cache() {
+    const auto input = WorkspaceCreationHelper::create2DWorkspace(3, 5);
+    const auto first = run(input, 2.0);
+    TS_ASSERT_EQUALS(ResultCacheTestAlgorithm::executions, 1);
+
+    const auto second = run(input, 2.0);
+    TS_ASSERT_EQUALS(ResultCacheTestAlgorithm::executions, 1);
+    TS_ASSERT_DIFFERS(first, second);
+    assertSameData(*first, *second);
+  }
+
+  void test_changed_inputs_are_executed_again() {
+    auto input = WorkspaceCreationHelper::create2DWorkspace(3, 5);
+    run(input, 2.0);
+    run(input, 3.0);
+    TS_ASSERT_EQUALS(ResultCacheTestAlgorithm::executions, 2);
+
+    // A change of the data which is not recorded in the history
+    input->mutableY(1)[2] += 1.0;
+    const auto output = run(input, 2.0);
+    TS_ASSERT_EQUALS(ResultCacheTestAlgorithm::executions, 3);
+    TS_ASSERT_EQUALS(output->y(1)[2], 2.0 * input->y(1)[2]);
+  }
+
+  void test_nothing_is_cached_when_disabled() {
+    ConfigService::Instance().setString("algorithms.resultcache.algorithms",
+                                        "");
+    const auto input = WorkspaceCreationHelper::create2DWorkspace(3, 5);
+    run(input, 2.0);
+    run(input, 2.0);
+    TS_ASSERT_EQUALS(ResultCacheTestAlgorithm::executions, 2);
+    TS_ASSERT(!Poco::File(m_directory).exists());
+  }
+
+private:
+  MatrixWorkspace_sptr run(const MatrixWorkspace_sptr &input,
+                           const double factor) {
+    ResultCacheTestAlgorithm alg;
+    alg.setChild(true);
+    alg.initialize();
+    alg.setProperty("InputWorkspace", input);
+    alg.setProperty("Factor", factor);
+    alg.setPropertyValue("OutputWorkspace", "out");
+    TS_ASSERT_THROWS_NOTHING(alg.execute());
+    TS_ASSERT(alg.isExecuted());
+    return alg.getProperty("OutputWorkspace");
+  }
+
+  void assertSameData(const MatrixWorkspace &lhs, const MatrixWorkspace &rhs) {
+    TS_ASSERT_EQUALS(lhs.getNumberHistograms(), rhs.getNumberHistograms());
+    for (size_t i = 0; i < lhs.getNumberHistograms(); ++i) {
+      TS_ASSERT_EQUALS(lhs.x(i).rawData(), rhs.x(i).rawData());
+      TS_ASSERT_EQUALS(lhs.y(i).rawData(), rhs.y(i).rawData());
+      TS_ASSERT_EQUALS(lhs.e(i).rawData(), rhs.e(i).rawData());
+    }
+  }
+
+  const std::string m_directory;
+};
+
+#endif /* MANTID_DATAHANDLING_ALGORITHMRESULTCACHEROUNDTRIPTEST_H_ */
@@ -62,6 +62,13 @@ public:
   int64_t getNDataColums() const { return m_BlockSize[1]; }
   // get pointer to the Nexus file --> compatribility testing only.
   ::NeXus::File *getFile() { return m_File.get(); }
+  /** Request the event data array to be compressed when it is created. Has no
+   * effect on an event data array already present in the file. Compressed
+   * arrays are best written once; rewriting boxes of a file-backed workspace
+   * in them is slow. */
+  void setCompressEvents(bool compress) { m_compressEvents = compress; }
+  /// @return true if new event data arrays are created compressed
+  bool getCompressEvents() const { return m_compressEvents; }
 
 private:
   /// Default size of the events block which can be written in the NeXus array
@@ -76,6 +83,8 @@ private:
   std::unique_ptr<::NeXus::File> m_File;
   /// identifier if the file open only for reading or is  in read/write
   bool m_ReadOnly;
+  /// if true, the event data array is created with NeXus compression
+  bool m_compressEvents;
   /// The size of the events block which can be written in the neXus array at
   /// once (continious part of the data block)
   size_t m_dataChunk;
@@ -111,6 +111,10 @@ private:
   boost::shared_ptr<API::MultipleExperimentInfos> m_mEI;
 
 public:
+  /// Number of events above which no more boxes are added to a block of
+  /// events read from or written to file in one operation
+  static constexpr uint64_t MAX_EVENTS_PER_BLOCK = 1000000;
+
   static ::NeXus::File *createOrOpenMDWSgroup(const std::string &fileName,
                                               int &nDims,
                                               const std::string &WSEventType,
@@ -135,6 +139,11 @@ public:
 
   static void saveWSGenericInfo(::NeXus::File *const file,
                                 API::IMDWorkspace_const_sptr ws);
+  // find the boxes whose events follow each other on file, so they can be
+  // read or written in one operation
+  static size_t findContiguousBoxes(const std::vector<uint64_t> &eventIndex,
+                                    size_t firstBox, uint64_t maxEvents,
+                                    std::vector<size_t> &blockBoxes);
 };
 
 template <typename T>
@@ -225,38 +225,48 @@ public:
    @return data    -- vector of events coordinates, their signal and error
    casted to coord_t type
    @param events    -- vector of events
-   @param reserveMemory -- reserve memory for events copying. Set to false if
-   one wants to add new events to the existing one.
+   @param replaceEvents -- replace the events already in the vector. Set to
+   false to add the new events after the existing ones. Either way the vector
+   is resized once, default constructing the new events, which are then
+   filled from the data.
   */
   static inline void dataToEvents(const std::vector<coord_t> &data,
                                   std::vector<MDEvent<nd>> &events,
-                                  bool reserveMemory = true) {
+                                  bool replaceEvents = true) {
+    dataToEvents(data.data(), data.data() + data.size(), events, replaceEvents);
+  }
+  /* static method used to convert a range of data into vector of events,
+   without copying the range into a vector first
+   @param begin -- start of the events data
+   @param end -- end of the events data
+   @param events    -- vector of events
+   @param replaceEvents -- as for the vector overload
+  */
+  static inline void dataToEvents(const coord_t *begin, const coord_t *end,
+                                  std::vector<MDEvent<nd>> &events,
+                                  bool replaceEvents = true) {
     // Number of columns = number of dimensions + 4 (signal/error)+detId+runID
     size_t numColumns = (nd + 4);
-    size_t numEvents = data.size() / numColumns;
-    if (numEvents * numColumns != data.size())
+    const auto size = static_cast<size_t>(end - begin);
+    size_t numEvents = size / numColumns;
+    if (numEvents * numColumns != size)
       throw(std::invalid_argument("wrong input array of data to convert to "
                                   "lean events, suspected column data for "
                                   "different dimensions/(type of) events "));
 
-    if (reserveMemory) // Reserve the amount of space needed. Significant speed
-                       // up (~30% thanks to this)
-    {
+    if (replaceEvents)
       events.clear();
-      events.reserve(numEvents);
-    }
-    for (size_t i = 0; i < numEvents; i++) {
-      // Index into the data array
-      size_t ii = i * numColumns;
-
-      // Point directly into the data block for the centers.
-      coord_t const *const centers = &(data[ii + 4]);
-
-      // Create the event with signal, error squared, and the centers
-      events.emplace_back(static_cast<signal_t>(data[ii]),
-                          static_cast<signal_t>(data[ii + 1]),
-                          static_cast<uint16_t>(data[ii + 2]),
-                          static_cast<int32_t>(data[ii + 3]), centers);
+    // Size the events vector once and fill the new events in place straight
+    // from the data block, rather than constructing them one by one.
+    const size_t nExisting = events.size();
+    events.resize(nExisting + numEvents);
+    auto event = events.begin() + nExisting;
+    for (auto column = begin; column != end; column += numColumns, ++event) {
+      event->signal = static_cast<float>(column[0]);
+      event->errorSquared = static_cast<float>(column[1]);
+      event->runIndex = static_cast<uint16_t>(column[2]);
+      event->detectorId = static_cast<int32_t>(column[3]);
+      std::copy(column + 4, column + numColumns, event->center);
     }
   }
 };
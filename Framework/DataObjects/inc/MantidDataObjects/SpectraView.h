@@ -0,0 +1,53 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2019 ISIS Rutherford Appleton Laboratory UKRI,
+//     NScD Oak Ridge National Laboratory, European Spallation Source
+//     & Institut Laue - Langevin
+// SPDX - License - Identifier: GPL - 3.0 +
+#ifndef MANTID_DATAOBJECTS_SPECTRAVIEW_H_
+#define MANTID_DATAOBJECTS_SPECTRAVIEW_H_
+
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+namespace Mantid {
+namespace DataObjects {
+
+/** SpectraView : A view of the values of a set of spectra with the same
+  number of bins as a row-major matrix, with one row per spectrum. Each row
+  points to the data of a spectrum, so loops across spectra can index the
+  values directly instead of going through the workspace for every value.
+
+  A view does not own the data. It is invalidated by anything that replaces
+  or resizes the arrays of the spectra, or by the workspace being deleted.
+*/
+template <typename T> class SpectraView {
+public:
+  SpectraView() = default;
+  /// Construct from pointers to the first value of each row
+  SpectraView(std::vector<T *> rows, const size_t numberOfColumns)
+      : m_rows(std::move(rows)), m_numberOfColumns(numberOfColumns) {}
+
+  /// The number of rows, i.e. spectra
+  size_t numberOfRows() const { return m_rows.size(); }
+  /// The number of columns, i.e. bins
+  size_t numberOfColumns() const { return m_numberOfColumns; }
+  /// Pointer to the first value of a row
+  T *row(const size_t rowIndex) const { return m_rows[rowIndex]; }
+  /// The value in a row and column
+  T &operator()(const size_t rowIndex, const size_t column) const {
+    return m_rows[rowIndex][column];
+  }
+
+private:
+  /// Pointers to the first value of each row
+  std::vector<T *> m_rows;
+  /// The number of values in each row
+  size_t m_numberOfColumns = 0;
+};
+
+} // namespace DataObjects
+} // namespace Mantid
+
+#endif /* MANTID_DATAOBJECTS_SPECTRAVIEW_H_ */
@@ -12,6 +12,7 @@
 //----------------------------------------------------------------------
 #include "MantidAPI/HistoWorkspace.h"
 #include "MantidDataObjects/Histogram1D.h"
+#include "MantidDataObjects/SpectraView.h"
 
 namespace Mantid {
 
@@ -61,6 +62,15 @@ public:
   }
   const Histogram1D &getSpectrum(const size_t index) const override;
 
+  /// Read-only view of the Y values of all spectra as a matrix
+  SpectraView<const double> yView() const;
+  /// Read-only view of the E values of all spectra as a matrix
+  SpectraView<const double> eView() const;
+  /// Writable view of the Y values of all spectra as a matrix
+  SpectraView<double> mutableYView();
+  /// Writable view of the E values of all spectra as a matrix
+  SpectraView<double> mutableEView();
+
   /// Generate a new histogram by rebinning the existing histogram.
   void generateHistogram(const std::size_t index, const MantidVec &X,
                          MantidVec &Y, MantidVec &E,
@@ -95,8 +105,9 @@ protected:
   /// a vector holding workspace index of monitors in the workspace
   std::vector<specnum_t> m_monitorList;
 
-  /// A vector that holds the 1D histograms
-  std::vector<std::unique_ptr<Histogram1D>> data;
+  /// A vector that holds the 1D histograms by value. Their X, Y and E arrays
+  /// are allocated separately.
+  std::vector<Histogram1D> data;
 
 private:
   Workspace2D *doClone() const override;
@@ -12,6 +12,7 @@
 #include "MantidKernel/DateAndTimeHelpers.h"
 #include "MantidKernel/Exception.h"
 #include "MantidKernel/Logger.h"
+#include "MantidKernel/MultiThreaded.h"
 #include "MantidKernel/Unit.h"
 
 #ifdef _MSC_VER
@@ -23,6 +24,7 @@
 #pragma warning(default : 4180)
 #endif
 
+#include <algorithm>
 #include <cfloat>
 #include <cmath>
 #include <functional>
@@ -91,6 +93,22 @@ public:
     return (tAtSample1 < tAtSample2);
   }
 };
+
+/**
+ * Sort a range of events, in parallel only if the calling thread has cores to
+ * spare. Lists are usually sorted from inside a parallel loop over spectra,
+ * where a parallel sort would oversubscribe the cores.
+ * @param begin :: start of the range
+ * @param end :: end of the range
+ * @param compare :: optional comparison function
+ */
+template <typename Iterator, typename... Compare>
+void sortEvents(Iterator begin, Iterator end, Compare... compare) {
+  if (Kernel::threadBudget() > 1)
+    tbb::parallel_sort(begin, end, compare...);
+  else
+    std::sort(begin, end, compare...);
+}
 } // namespace
 //==========================================================================
 /// --------------------- TofEvent Comparators
@@ -997,14 +1015,13 @@ void EventList::sortTof() const {
 
   switch (eventType) {
   case TOF:
-    tbb::parallel_sort(events.begin(), events.end());
+    sortEvents(events.begin(), events.end());
     break;
   case WEIGHTED:
-    tbb::parallel_sort(weightedEvents.begin(), weightedEvents.end());
+    sortEvents(weightedEvents.begin(), weightedEvents.end());
     break;
   case WEIGHTED_NOTIME:
-    tbb::parallel_sort(weightedEventsNoTime.begin(),
-                       weightedEventsNoTime.end());
+    sortEvents(weightedEventsNoTime.begin(), weightedEventsNoTime.end());
     break;
   }
   // Save the order to avoid unnecessary re-sorting.
@@ -1037,17 +1054,16 @@ void EventList::sortTimeAtSample(const double &tofFactor,
   switch (eventType) {
   case TOF: {
     CompareTimeAtSample<TofEvent> comparitor(tofFactor, tofShift);
-    tbb::parallel_sort(events.begin(), events.end(), comparitor);
+    sortEvents(events.begin(), events.end(), comparitor);
   } break;
   case WEIGHTED: {
     CompareTimeAtSample<WeightedEvent> comparitor(tofFactor, tofShift);
-    tbb::parallel_sort(weightedEvents.begin(), weightedEvents.end(),
-                       comparitor);
+    sortEvents(weightedEvents.begin(), weightedEvents.end(), comparitor);
   } break;
   case WEIGHTED_NOTIME: {
     CompareTimeAtSample<WeightedEventNoTime> comparitor(tofFactor, tofShift);
-    tbb::parallel_sort(weightedEventsNoTime.begin(), weightedEventsNoTime.end(),
-                       comparitor);
+    sortEvents(weightedEventsNoTime.begin(), weightedEventsNoTime.end(),
+               comparitor);
   } break;
   }
   // Save the order to avoid unnecessary re-sorting.
@@ -1069,11 +1085,11 @@ void EventList::sortPulseTime() const {
   // Perform sort.
   switch (eventType) {
   case TOF:
-    tbb::parallel_sort(events.begin(), events.end(), compareEventPulseTime);
+    sortEvents(events.begin(), events.end(), compareEventPulseTime);
     break;
   case WEIGHTED:
-    tbb::parallel_sort(weightedEvents.begin(), weightedEvents.end(),
-                       compareEventPulseTime);
+    sortEvents(weightedEvents.begin(), weightedEvents.end(),
+               compareEventPulseTime);
     break;
   case WEIGHTED_NOTIME:
     // Do nothing; there is no time to sort
@@ -1099,11 +1115,11 @@ void EventList::sortPulseTimeTOF() const {
 
   switch (eventType) {
   case TOF:
-    tbb::parallel_sort(events.begin(), events.end(), compareEventPulseTimeTOF);
+    sortEvents(events.begin(), events.end(), compareEventPulseTimeTOF);
     break;
   case WEIGHTED:
-    tbb::parallel_sort(weightedEvents.begin(), weightedEvents.end(),
-                       compareEventPulseTimeTOF);
+    sortEvents(weightedEvents.begin(), weightedEvents.end(),
+               compareEventPulseTimeTOF);
     break;
   case WEIGHTED_NOTIME:
     // Do nothing; there is no time to sort
@@ -1131,11 +1147,10 @@ void EventList::sortPulseTimeTOFDelta(const Types::Core::DateAndTime &start,
 
   switch (eventType) {
   case TOF:
-    tbb::parallel_sort(events.begin(), events.end(), comparator);
+    sortEvents(events.begin(), events.end(), comparator);
     break;
   case WEIGHTED:
-    tbb::parallel_sort(weightedEvents.begin(), weightedEvents.end(),
-                       comparator);
+    sortEvents(weightedEvents.begin(), weightedEvents.end(), comparator);
     break;
   case WEIGHTED_NOTIME:
     // Do nothing; there is no time to sort
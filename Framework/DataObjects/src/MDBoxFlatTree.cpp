@@ -783,6 +783,44 @@ void MDBoxFlatTree::saveWSGenericInfo(::NeXus::File *const file,
   }
 }
 
+constexpr uint64_t MDBoxFlatTree::MAX_EVENTS_PER_BLOCK;
+
+/** Find the boxes, starting from the given one, whose events are stored one
+ * after the other in the event data array, so that their events can be read or
+ * written with a single file operation. Boxes without events are passed over.
+ *
+ * @param eventIndex :: file position and number of events of each box, as
+ * returned by getEventIndex()
+ * @param firstBox :: index of the box to start the search from
+ * @param maxEvents :: no box is added once the block holds this many events
+ * @param blockBoxes :: [out] indices of the boxes forming the block
+ * @return the index of the box to start the next search from
+ */
+size_t
+MDBoxFlatTree::findContiguousBoxes(const std::vector<uint64_t> &eventIndex,
+                                   size_t firstBox, uint64_t maxEvents,
+                                   std::vector<size_t> &blockBoxes) {
+  blockBoxes.clear();
+  const size_t nBoxes = eventIndex.size() / 2;
+  uint64_t blockStart(0), blockEnd(0);
+  size_t i = firstBox;
+  for (; i < nBoxes; ++i) {
+    const uint64_t nEvents = eventIndex[2 * i + 1];
+    if (nEvents == 0)
+      continue;
+    const uint64_t position = eventIndex[2 * i];
+    if (blockBoxes.empty()) {
+      blockStart = position;
+      blockEnd = position;
+    } else if (position != blockEnd || blockEnd - blockStart >= maxEvents) {
+      break;
+    }
+    blockBoxes.push_back(i);
+    blockEnd += nEvents;
+  }
+  return i;
+}
+
 /**
  * Save the affine matrices to both directional conversions to the
  * data.
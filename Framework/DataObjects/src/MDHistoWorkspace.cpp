@@ -13,6 +13,7 @@
 #include "MantidGeometry/MDGeometry/MDDimensionExtents.h"
 #include "MantidGeometry/MDGeometry/MDGeometryXMLBuilder.h"
 #include "MantidGeometry/MDGeometry/MDHistoDimension.h"
+#include "MantidKernel/MultiThreaded.h"
 #include "MantidKernel/System.h"
 #include "MantidKernel/Utils.h"
 #include "MantidKernel/VMD.h"
@@ -28,6 +29,12 @@ using namespace Mantid::Kernel;
 using namespace Mantid::Geometry;
 using namespace Mantid::API;
 
+namespace {
+/// Below this number of points the element-wise operations run serially, as
+/// starting the threads costs more than the loop
+constexpr int64_t MIN_PARALLEL_LENGTH = 10000;
+} // namespace
+
 namespace Mantid {
 namespace DataObjects {
 //----------------------------------------------------------------------------------------------
@@ -780,7 +787,9 @@ MDHistoWorkspace &MDHistoWorkspace::operator+=(const MDHistoWorkspace &b) {
  * */
 void MDHistoWorkspace::add(const MDHistoWorkspace &b) {
   checkWorkspaceSize(b, "add");
-  for (size_t i = 0; i < m_length; ++i) {
+  const auto length = static_cast<int64_t>(m_length);
+  PARALLEL_FOR_IF(length > MIN_PARALLEL_LENGTH)
+  for (int64_t i = 0; i < length; ++i) {
     m_signals[i] += b.m_signals[i];
     m_errorsSquared[i] += b.m_errorsSquared[i];
     m_numEvents[i] += b.m_numEvents[i];
@@ -796,7 +805,9 @@ void MDHistoWorkspace::add(const MDHistoWorkspace &b) {
  * */
 void MDHistoWorkspace::add(const signal_t signal, const signal_t error) {
   signal_t errorSquared = error * error;
-  for (size_t i = 0; i < m_length; ++i) {
+  const auto length = static_cast<int64_t>(m_length);
+  PARALLEL_FOR_IF(length > MIN_PARALLEL_LENGTH)
+  for (int64_t i = 0; i < length; ++i) {
     m_signals[i] += signal;
     m_errorsSquared[i] += errorSquared;
   }
@@ -819,7 +830,9 @@ MDHistoWorkspace &MDHistoWorkspace::operator-=(const MDHistoWorkspace &b) {
  * */
 void MDHistoWorkspace::subtract(const MDHistoWorkspace &b) {
   checkWorkspaceSize(b, "subtract");
-  for (size_t i = 0; i < m_length; ++i) {
+  const auto length = static_cast<int64_t>(m_length);
+  PARALLEL_FOR_IF(length > MIN_PARALLEL_LENGTH)
+  for (int64_t i = 0; i < length; ++i) {
     m_signals[i] -= b.m_signals[i];
     m_errorsSquared[i] += b.m_errorsSquared[i];
     m_numEvents[i] += b.m_numEvents[i];
@@ -835,7 +848,9 @@ void MDHistoWorkspace::subtract(const MDHistoWorkspace &b) {
  * */
 void MDHistoWorkspace::subtract(const signal_t signal, const signal_t error) {
   signal_t errorSquared = error * error;
-  for (size_t i = 0; i < m_length; ++i) {
+  const auto length = static_cast<int64_t>(m_length);
+  PARALLEL_FOR_IF(length > MIN_PARALLEL_LENGTH)
+  for (int64_t i = 0; i < length; ++i) {
     m_signals[i] -= signal;
     m_errorsSquared[i] += errorSquared;
   }
@@ -867,7 +882,9 @@ MDHistoWorkspace &MDHistoWorkspace::operator*=(const MDHistoWorkspace &b_ws) {
  * */
 void MDHistoWorkspace::multiply(const MDHistoWorkspace &b_ws) {
   checkWorkspaceSize(b_ws, "multiply");
-  for (size_t i = 0; i < m_length; ++i) {
+  const auto length = static_cast<int64_t>(m_length);
+  PARALLEL_FOR_IF(length > MIN_PARALLEL_LENGTH)
+  for (int64_t i = 0; i < length; ++i) {
     signal_t a = m_signals[i];
     signal_t da2 = m_errorsSquared[i];
 
@@ -898,7 +915,9 @@ void MDHistoWorkspace::multiply(const signal_t signal, const signal_t error) {
   signal_t b = signal;
   signal_t db2 = error * error;
 
-  for (size_t i = 0; i < m_length; ++i) {
+  const auto length = static_cast<int64_t>(m_length);
+  PARALLEL_FOR_IF(length > MIN_PARALLEL_LENGTH)
+  for (int64_t i = 0; i < length; ++i) {
     signal_t a = m_signals[i];
     signal_t da2 = m_errorsSquared[i];
 
@@ -936,7 +955,9 @@ MDHistoWorkspace &MDHistoWorkspace::operator/=(const MDHistoWorkspace &b_ws) {
  **/
 void MDHistoWorkspace::divide(const MDHistoWorkspace &b_ws) {
   checkWorkspaceSize(b_ws, "divide");
-  for (size_t i = 0; i < m_length; ++i) {
+  const auto length = static_cast<int64_t>(m_length);
+  PARALLEL_FOR_IF(length > MIN_PARALLEL_LENGTH)
+  for (int64_t i = 0; i < length; ++i) {
     signal_t a = m_signals[i];
     signal_t da2 = m_errorsSquared[i];
 
@@ -967,7 +988,9 @@ void MDHistoWorkspace::divide(const signal_t signal, const signal_t error) {
   signal_t b = signal;
   signal_t db2 = error * error;
   signal_t db2_relative = db2 / (b * b);
-  for (size_t i = 0; i < m_length; ++i) {
+  const auto length = static_cast<int64_t>(m_length);
+  PARALLEL_FOR_IF(length > MIN_PARALLEL_LENGTH)
+  for (int64_t i = 0; i < length; ++i) {
     signal_t a = m_signals[i];
     signal_t da2 = m_errorsSquared[i];
 
@@ -986,7 +1009,9 @@ void MDHistoWorkspace::divide(const signal_t signal, const signal_t error) {
  * \f$ df^2 = a^2 / da^2 \f$
  */
 void MDHistoWorkspace::log(double filler) {
-  for (size_t i = 0; i < m_length; ++i) {
+  const auto length = static_cast<int64_t>(m_length);
+  PARALLEL_FOR_IF(length > MIN_PARALLEL_LENGTH)
+  for (int64_t i = 0; i < length; ++i) {
     signal_t a = m_signals[i];
     signal_t da2 = m_errorsSquared[i];
     if (a <= 0) {
@@ -1006,7 +1031,9 @@ void MDHistoWorkspace::log(double filler) {
  * \f$ df^2 = (ln(10)^-2) * a^2 / da^2 \f$
  */
 void MDHistoWorkspace::log10(double filler) {
-  for (size_t i = 0; i < m_length; ++i) {
+  const auto length = static_cast<int64_t>(m_length);
+  PARALLEL_FOR_IF(length > MIN_PARALLEL_LENGTH)
+  for (int64_t i = 0; i < length; ++i) {
     signal_t a = m_signals[i];
     signal_t da2 = m_errorsSquared[i];
     if (a <= 0) {
@@ -1026,7 +1053,9 @@ void MDHistoWorkspace::log10(double filler) {
  * \f$ df^2 = f^2 * da^2 \f$
  */
 void MDHistoWorkspace::exp() {
-  for (size_t i = 0; i < m_length; ++i) {
+  const auto length = static_cast<int64_t>(m_length);
+  PARALLEL_FOR_IF(length > MIN_PARALLEL_LENGTH)
+  for (int64_t i = 0; i < length; ++i) {
     signal_t f = std::exp(m_signals[i]);
     signal_t da2 = m_errorsSquared[i];
     m_signals[i] = f;
@@ -1043,7 +1072,9 @@ void MDHistoWorkspace::exp() {
  */
 void MDHistoWorkspace::power(double exponent) {
   double exponent_squared = exponent * exponent;
-  for (size_t i = 0; i < m_length; ++i) {
+  const auto length = static_cast<int64_t>(m_length);
+  PARALLEL_FOR_IF(length > MIN_PARALLEL_LENGTH)
+  for (int64_t i = 0; i < length; ++i) {
     signal_t a = m_signals[i];
     signal_t f = std::pow(a, exponent);
     signal_t da2 = m_errorsSquared[i];
@@ -1123,7 +1154,9 @@ MDHistoWorkspace &MDHistoWorkspace::operator^=(const MDHistoWorkspace &b) {
  * 0.0 is "false", all other values are "true". All errors are set to 0.
  */
 void MDHistoWorkspace::operatorNot() {
-  for (size_t i = 0; i < m_length; ++i) {
+  const auto length = static_cast<int64_t>(m_length);
+  PARALLEL_FOR_IF(length > MIN_PARALLEL_LENGTH)
+  for (int64_t i = 0; i < length; ++i) {
     m_signals[i] = (m_signals[i] == 0.0 || m_masks[i]);
     m_errorsSquared[i] = 0;
   }
@@ -1139,7 +1172,9 @@ void MDHistoWorkspace::operatorNot() {
  */
 void MDHistoWorkspace::lessThan(const MDHistoWorkspace &b) {
   checkWorkspaceSize(b, "lessThan");
-  for (size_t i = 0; i < m_length; ++i) {
+  const auto length = static_cast<int64_t>(m_length);
+  PARALLEL_FOR_IF(length > MIN_PARALLEL_LENGTH)
+  for (int64_t i = 0; i < length; ++i) {
     m_signals[i] = (m_signals[i] < b.m_signals[i]) ? 1.0 : 0.0;
     m_errorsSquared[i] = 0;
   }
@@ -1154,7 +1189,9 @@ void MDHistoWorkspace::lessThan(const MDHistoWorkspace &b) {
  * @param signal :: signal value on the RHS of the comparison.
  */
 void MDHistoWorkspace::lessThan(const signal_t signal) {
-  for (size_t i = 0; i < m_length; ++i) {
+  const auto length = static_cast<int64_t>(m_length);
+  PARALLEL_FOR_IF(length > MIN_PARALLEL_LENGTH)
+  for (int64_t i = 0; i < length; ++i) {
     m_signals[i] = (m_signals[i] < signal) ? 1.0 : 0.0;
     m_errorsSquared[i] = 0;
   }
@@ -1170,7 +1207,9 @@ void MDHistoWorkspace::lessThan(const signal_t signal) {
  */
 void MDHistoWorkspace::greaterThan(const MDHistoWorkspace &b) {
   checkWorkspaceSize(b, "greaterThan");
-  for (size_t i = 0; i < m_length; ++i) {
+  const auto length = static_cast<int64_t>(m_length);
+  PARALLEL_FOR_IF(length > MIN_PARALLEL_LENGTH)
+  for (int64_t i = 0; i < length; ++i) {
     m_signals[i] = (m_signals[i] > b.m_signals[i]) ? 1.0 : 0.0;
     m_errorsSquared[i] = 0;
   }
@@ -1185,7 +1224,9 @@ void MDHistoWorkspace::greaterThan(const MDHistoWorkspace &b) {
  * @param signal :: signal value on the RHS of the comparison.
  */
 void MDHistoWorkspace::greaterThan(const signal_t signal) {
-  for (size_t i = 0; i < m_length; ++i) {
+  const auto length = static_cast<int64_t>(m_length);
+  PARALLEL_FOR_IF(length > MIN_PARALLEL_LENGTH)
+  for (int64_t i = 0; i < length; ++i) {
     m_signals[i] = (m_signals[i] > signal) ? 1.0 : 0.0;
     m_errorsSquared[i] = 0;
   }
@@ -1203,7 +1244,9 @@ void MDHistoWorkspace::greaterThan(const signal_t signal) {
 void MDHistoWorkspace::equalTo(const MDHistoWorkspace &b,
                                const signal_t tolerance) {
   checkWorkspaceSize(b, "equalTo");
-  for (size_t i = 0; i < m_length; ++i) {
+  const auto length = static_cast<int64_t>(m_length);
+  PARALLEL_FOR_IF(length > MIN_PARALLEL_LENGTH)
+  for (int64_t i = 0; i < length; ++i) {
     signal_t diff = fabs(m_signals[i] - b.m_signals[i]);
     m_signals[i] = (diff < tolerance) ? 1.0 : 0.0;
     m_errorsSquared[i] = 0;
@@ -1221,7 +1264,9 @@ void MDHistoWorkspace::equalTo(const MDHistoWorkspace &b,
  */
 void MDHistoWorkspace::equalTo(const signal_t signal,
                                const signal_t tolerance) {
-  for (size_t i = 0; i < m_length; ++i) {
+  const auto length = static_cast<int64_t>(m_length);
+  PARALLEL_FOR_IF(length > MIN_PARALLEL_LENGTH)
+  for (int64_t i = 0; i < length; ++i) {
     signal_t diff = fabs(m_signals[i] - signal);
     m_signals[i] = (diff < tolerance) ? 1.0 : 0.0;
     m_errorsSquared[i] = 0;
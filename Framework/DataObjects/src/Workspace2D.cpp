@@ -23,6 +23,22 @@ namespace Mantid {
 namespace DataObjects {
 using std::size_t;
 
+namespace {
+/** Fill the spectra with copies of a spectrum. The copies share the arrays
+ * of the spectrum until they are modified.
+ * @param data :: the spectra to fill
+ * @param numberOfSpectra :: the number of spectra
+ * @param spec :: the spectrum to copy
+ */
+void fillSpectra(std::vector<Histogram1D> &data, const size_t numberOfSpectra,
+                 const Histogram1D &spec) {
+  // Construct the copies rather than assigning to any existing spectra, which
+  // would refer back to the workspace while it is being resized
+  data.clear();
+  data.assign(numberOfSpectra, spec);
+}
+} // namespace
+
 DECLARE_WORKSPACE(Workspace2D)
 
 /// Constructor
@@ -30,12 +46,8 @@ Workspace2D::Workspace2D(const Parallel::StorageMode storageMode)
     : HistoWorkspace(storageMode) {}
 
 Workspace2D::Workspace2D(const Workspace2D &other)
-    : HistoWorkspace(other), m_monitorList(other.m_monitorList) {
-  data.resize(other.data.size());
-  for (size_t i = 0; i < data.size(); ++i) {
-    data[i] = std::make_unique<Histogram1D>(*(other.data[i]));
-  }
-}
+    : HistoWorkspace(other), m_monitorList(other.m_monitorList),
+      data(other.data) {}
 
 /// Destructor
 Workspace2D::~Workspace2D() {}
@@ -54,8 +66,6 @@ Workspace2D::~Workspace2D() {}
  */
 void Workspace2D::init(const std::size_t &NVectors, const std::size_t &XLength,
                        const std::size_t &YLength) {
-  data.resize(NVectors);
-
   auto x = Kernel::make_cow<HistogramData::HistogramX>(
       XLength, HistogramData::LinearGenerator(1.0, 1.0));
   HistogramData::Counts y(YLength);
@@ -65,10 +75,10 @@ void Workspace2D::init(const std::size_t &NVectors, const std::size_t &XLength,
   spec.setX(x);
   spec.setCounts(y);
   spec.setCountStandardDeviations(e);
+  fillSpectra(data, NVectors, spec);
   for (size_t i = 0; i < data.size(); i++) {
-    data[i] = std::make_unique<Histogram1D>(spec);
     // Default spectrum number = starts at 1, for workspace index 0.
-    data[i]->setSpectrumNo(specnum_t(i + 1));
+    data[i].setSpectrumNo(specnum_t(i + 1));
   }
 
   // Add axes that reference the data
@@ -78,8 +88,6 @@ void Workspace2D::init(const std::size_t &NVectors, const std::size_t &XLength,
 }
 
 void Workspace2D::init(const HistogramData::Histogram &histogram) {
-  data.resize(numberOfDetectorGroups());
-
   HistogramData::Histogram initializedHistogram(histogram);
   if (!histogram.sharedY()) {
     if (histogram.yMode() == HistogramData::Histogram::YMode::Frequencies) {
@@ -94,9 +102,7 @@ void Workspace2D::init(const HistogramData::Histogram &histogram) {
 
   Histogram1D spec(initializedHistogram.xMode(), initializedHistogram.yMode());
   spec.setHistogram(initializedHistogram);
-  for (auto &i : data) {
-    i = std::make_unique<Histogram1D>(spec);
-  }
+  fillSpectra(data, numberOfDetectorGroups(), spec);
 
   // Add axes that reference the data
   m_axes.resize(2);
@@ -115,8 +121,8 @@ size_t Workspace2D::getNumberHistograms() const {
 size_t Workspace2D::size() const {
   return std::accumulate(
       data.begin(), data.end(), static_cast<size_t>(0),
-      [](const size_t value, const std::unique_ptr<Histogram1D> &histo) {
-        return value + histo->size();
+      [](const size_t value, const Histogram1D &histo) {
+        return value + histo.size();
       });
 }
 
@@ -125,9 +131,9 @@ size_t Workspace2D::blocksize() const {
   if (data.empty()) {
     return 0;
   } else {
-    size_t numBins = data[0]->size();
+    size_t numBins = data[0].size();
     for (const auto &iter : data)
-      if (numBins != iter->size())
+      if (numBins != iter.size())
         throw std::length_error(
             "blocksize undefined because size of histograms is not equal");
     return numBins;
@@ -222,8 +228,8 @@ void Workspace2D::setImageYAndE(const API::MantidImage &imageY,
       auto pE = rowE.begin();
       for (auto pY = rowY.begin(); pY != rowY.end() && pE != rowE.end();
            ++pY, ++pE, ++spec) {
-        data[spec]->dataY()[0] = *pY;
-        data[spec]->dataE()[0] = *pE;
+        data[spec].dataY()[0] = *pY;
+        data[spec].dataE()[0] = *pE;
       }
     }
   } else {
@@ -250,18 +256,18 @@ void Workspace2D::setImageYAndE(const API::MantidImage &imageY,
 
       const auto &rowY = imageY[i];
       const auto &rowE = imageE[i];
-      data[i]->dataY() = rowY;
-      data[i]->dataE() = rowE;
+      data[i].dataY() = rowY;
+      data[i].dataE() = rowE;
     }
     // X values. Set first spectrum and copy/propagate that one to all the other
     // spectra
     PARALLEL_FOR_IF(parallelExecution)
     for (int i = 0; i < static_cast<int>(width) + 1; ++i) {
-      data[0]->dataX()[i] = i * scale_1;
+      data[0].dataX()[i] = i * scale_1;
     }
     PARALLEL_FOR_IF(parallelExecution)
     for (int i = 1; i < static_cast<int>(height); ++i) {
-      data[i]->setX(data[0]->ptrX());
+      data[i].setX(data[0].ptrX());
     }
   }
 }
@@ -282,7 +288,61 @@ const Histogram1D &Workspace2D::getSpectrum(const size_t index) const {
        << " out of range " << data.size();
     throw std::range_error(ss.str());
   }
-  return *data[index];
+  return data[index];
+}
+
+/** Get a view of the Y values of all spectra as a matrix with one row per
+ * spectrum.
+ * @throws std::length_error if the spectra have different numbers of bins
+ */
+SpectraView<const double> Workspace2D::yView() const {
+  const size_t numberOfColumns = blocksize();
+  std::vector<const double *> rows(data.size());
+  std::transform(data.cbegin(), data.cend(), rows.begin(),
+                 [](const Histogram1D &spec) {
+                   return spec.y().rawData().data();
+                 });
+  return SpectraView<const double>(std::move(rows), numberOfColumns);
+}
+
+/** Get a view of the E values of all spectra as a matrix with one row per
+ * spectrum.
+ * @throws std::length_error if the spectra have different numbers of bins
+ */
+SpectraView<const double> Workspace2D::eView() const {
+  const size_t numberOfColumns = blocksize();
+  std::vector<const double *> rows(data.size());
+  std::transform(data.cbegin(), data.cend(), rows.begin(),
+                 [](const Histogram1D &spec) {
+                   return spec.e().rawData().data();
+                 });
+  return SpectraView<const double>(std::move(rows), numberOfColumns);
+}
+
+/** Get a writable view of the Y values of all spectra as a matrix with one
+ * row per spectrum. Any Y arrays shared between spectra are copied first.
+ * @throws std::length_error if the spectra have different numbers of bins
+ */
+SpectraView<double> Workspace2D::mutableYView() {
+  const size_t numberOfColumns = blocksize();
+  std::vector<double *> rows(data.size());
+  PARALLEL_FOR_NO_WSP_CHECK()
+  for (int64_t i = 0; i < static_cast<int64_t>(data.size()); ++i)
+    rows[i] = data[i].mutableY().mutableRawData().data();
+  return SpectraView<double>(std::move(rows), numberOfColumns);
+}
+
+/** Get a writable view of the E values of all spectra as a matrix with one
+ * row per spectrum. Any E arrays shared between spectra are copied first.
+ * @throws std::length_error if the spectra have different numbers of bins
+ */
+SpectraView<double> Workspace2D::mutableEView() {
+  const size_t numberOfColumns = blocksize();
+  std::vector<double *> rows(data.size());
+  PARALLEL_FOR_NO_WSP_CHECK()
+  for (int64_t i = 0; i < static_cast<int64_t>(data.size()); ++i)
+    rows[i] = data[i].mutableE().mutableRawData().data();
+  return SpectraView<double>(std::move(rows), numberOfColumns);
 }
 
 //--------------------------------------------------------------------------------------------
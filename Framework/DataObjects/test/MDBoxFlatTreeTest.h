@@ -108,6 +108,43 @@ public:
       testFile.remove();
   }
 
+  void test_findContiguousBoxes() {
+    // file position/number of events pairs: a grid box, three boxes one after
+    // the other, an empty box, then a box after a gap in the file
+    std::vector<uint64_t> eventIndex{0, 0,  0, 10, 10, 5,
+                                     15, 20, 0, 0, 100, 7};
+    std::vector<size_t> blockBoxes;
+
+    size_t next = MDBoxFlatTree::findContiguousBoxes(eventIndex, 0, 1000,
+                                                     blockBoxes);
+    TS_ASSERT_EQUALS(blockBoxes, std::vector<size_t>({1, 2, 3}));
+    TS_ASSERT_EQUALS(next, 5);
+
+    next = MDBoxFlatTree::findContiguousBoxes(eventIndex, next, 1000,
+                                              blockBoxes);
+    TS_ASSERT_EQUALS(blockBoxes, std::vector<size_t>({5}));
+    TS_ASSERT_EQUALS(next, 6);
+
+    next = MDBoxFlatTree::findContiguousBoxes(eventIndex, next, 1000,
+                                              blockBoxes);
+    TS_ASSERT(blockBoxes.empty());
+    TS_ASSERT_EQUALS(next, 6);
+  }
+
+  void test_findContiguousBoxes_stops_at_maxEvents() {
+    std::vector<uint64_t> eventIndex{0, 10, 10, 5, 15, 20};
+    std::vector<size_t> blockBoxes;
+
+    size_t next =
+        MDBoxFlatTree::findContiguousBoxes(eventIndex, 0, 15, blockBoxes);
+    TS_ASSERT_EQUALS(blockBoxes, std::vector<size_t>({0, 1}));
+    TS_ASSERT_EQUALS(next, 2);
+
+    next = MDBoxFlatTree::findContiguousBoxes(eventIndex, next, 15, blockBoxes);
+    TS_ASSERT_EQUALS(blockBoxes, std::vector<size_t>({2}));
+    TS_ASSERT_EQUALS(next, 3);
+  }
+
 private:
   Mantid::API::IMDEventWorkspace_sptr spEw3;
 };
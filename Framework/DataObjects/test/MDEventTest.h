@@ -242,6 +242,66 @@ public:
                       transfEvents[nPoints + i].getCenter(3), 1.e-6);
     }
   }
+
+  void test_dataToEvents_appends_different_lean_events() {
+    const coord_t existingCenter[3] = {1.f, 2.f, 3.f};
+    std::vector<MDLeanEvent<3>> events(2, MDLeanEvent<3>(4.f, 5.f,
+                                                         existingCenter));
+    const std::vector<coord_t> data{6.f,  7.f,  8.f,  9.f,  10.f,
+                                    11.f, 12.f, 13.f, 14.f, 15.f};
+
+    MDLeanEvent<3>::dataToEvents(data, events, false);
+    TS_ASSERT_EQUALS(events.size(), 4);
+    for (size_t i = 0; i < 2; ++i) {
+      TS_ASSERT_EQUALS(events[i].getSignal(), 4.f);
+      TS_ASSERT_EQUALS(events[i].getErrorSquared(), 5.f);
+      for (size_t d = 0; d < 3; ++d)
+        TS_ASSERT_EQUALS(events[i].getCenter(d), existingCenter[d]);
+    }
+    for (size_t i = 0; i < 2; ++i) {
+      const auto column = data.cbegin() + 5 * i;
+      TS_ASSERT_EQUALS(events[2 + i].getSignal(), column[0]);
+      TS_ASSERT_EQUALS(events[2 + i].getErrorSquared(), column[1]);
+      for (size_t d = 0; d < 3; ++d)
+        TS_ASSERT_EQUALS(events[2 + i].getCenter(d), column[2 + d]);
+    }
+
+    MDLeanEvent<3>::dataToEvents(data, events);
+    TS_ASSERT_EQUALS(events.size(), 2);
+    TS_ASSERT_EQUALS(events[0].getSignal(), 6.f);
+  }
+
+  void test_dataToEvents_appends_different_events() {
+    const coord_t existingCenter[2] = {1.f, 2.f};
+    std::vector<MDEvent<2>> events(
+        2, MDEvent<2>(3.f, 4.f, uint16_t(5), 6, existingCenter));
+    const std::vector<coord_t> data{7.f,  8.f,  9.f,  10.f, 11.f, 12.f,
+                                    13.f, 14.f, 15.f, 16.f, 17.f, 18.f};
+
+    MDEvent<2>::dataToEvents(data, events, false);
+    TS_ASSERT_EQUALS(events.size(), 4);
+    for (size_t i = 0; i < 2; ++i) {
+      TS_ASSERT_EQUALS(events[i].getSignal(), 3.f);
+      TS_ASSERT_EQUALS(events[i].getErrorSquared(), 4.f);
+      TS_ASSERT_EQUALS(events[i].getRunIndex(), 5);
+      TS_ASSERT_EQUALS(events[i].getDetectorID(), 6);
+      for (size_t d = 0; d < 2; ++d)
+        TS_ASSERT_EQUALS(events[i].getCenter(d), existingCenter[d]);
+    }
+    for (size_t i = 0; i < 2; ++i) {
+      const auto column = data.cbegin() + 6 * i;
+      TS_ASSERT_EQUALS(events[2 + i].getSignal(), column[0]);
+      TS_ASSERT_EQUALS(events[2 + i].getErrorSquared(), column[1]);
+      TS_ASSERT_EQUALS(events[2 + i].getRunIndex(), uint16_t(column[2]));
+      TS_ASSERT_EQUALS(events[2 + i].getDetectorID(), int32_t(column[3]));
+      for (size_t d = 0; d < 2; ++d)
+        TS_ASSERT_EQUALS(events[2 + i].getCenter(d), column[4 + d]);
+    }
+
+    MDEvent<2>::dataToEvents(data, events);
+    TS_ASSERT_EQUALS(events.size(), 2);
+    TS_ASSERT_EQUALS(events[0].getSignal(), 7.f);
+  }
 };
 
 class MDEventTestPerformance : public CxxTest::TestSuite {
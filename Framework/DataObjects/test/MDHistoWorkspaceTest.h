@@ -104,6 +104,17 @@ public:
     }
   }
 
+  /** Create a 200x200 workspace with signal = scale * index and error squared
+   * = index at each point */
+  MDHistoWorkspace_sptr makeLargeWorkspace(double scale) {
+    auto ws = MDEventsTestHelper::makeFakeMDHistoWorkspace(0.0, 2, 200);
+    for (size_t i = 0; i < ws->getNPoints(); ++i) {
+      ws->setSignalAt(i, scale * static_cast<double>(i));
+      ws->setErrorSquaredAt(i, static_cast<double>(i));
+    }
+    return ws;
+  }
+
   //--------------------------------------------------------------------------------------
   void test_constructor() {
     Mantid::Geometry::GeneralFrame frame("m", "m");
@@ -1061,6 +1072,63 @@ public:
     checkWorkspace(a, 1.0, 0.0);
   }
 
+  //--------------------------------------------------------------------------------------
+  // 200x200 points run the element-wise operations in parallel
+  void test_plus_ws_large() {
+    auto a = makeLargeWorkspace(1.0);
+    auto b = makeLargeWorkspace(2.0);
+    a->add(*b);
+    size_t wrong = 0;
+    for (size_t i = 0; i < a->getNPoints(); ++i) {
+      const auto x = static_cast<double>(i);
+      if (a->getSignalAt(i) != 3.0 * x ||
+          a->getErrorAt(i) != std::sqrt(2.0 * x) || a->getNumEventsAt(i) != 2.0)
+        ++wrong;
+    }
+    TS_ASSERT_EQUALS(wrong, 0);
+  }
+
+  void test_times_ws_large() {
+    auto a = makeLargeWorkspace(1.0);
+    auto b = makeLargeWorkspace(2.0);
+    a->multiply(*b);
+    size_t wrong = 0;
+    for (size_t i = 0; i < a->getNPoints(); ++i) {
+      const auto x = static_cast<double>(i);
+      // df2 = da2 * b^2 + db2 * a^2
+      const double errorSquared = x * (2.0 * x) * (2.0 * x) + x * x * x;
+      if (a->getSignalAt(i) != x * (2.0 * x) ||
+          a->getErrorAt(i) != std::sqrt(errorSquared))
+        ++wrong;
+    }
+    TS_ASSERT_EQUALS(wrong, 0);
+  }
+
+  void test_boolean_operations_large() {
+    auto a = makeLargeWorkspace(1.0);
+    const auto half = static_cast<double>(a->getNPoints() / 2);
+    a->lessThan(half);
+    auto b = makeLargeWorkspace(1.0);
+    b->greaterThan(*makeLargeWorkspace(0.5));
+    auto c = makeLargeWorkspace(1.0);
+    c->equalTo(half);
+    auto d = makeLargeWorkspace(1.0);
+    d->operatorNot();
+    size_t wrong = 0;
+    for (size_t i = 0; i < a->getNPoints(); ++i) {
+      const auto x = static_cast<double>(i);
+      if (a->getSignalAt(i) != (x < half ? 1.0 : 0.0) ||
+          b->getSignalAt(i) != (i > 0 ? 1.0 : 0.0) ||
+          c->getSignalAt(i) != (x == half ? 1.0 : 0.0) ||
+          d->getSignalAt(i) != (i == 0 ? 1.0 : 0.0))
+        ++wrong;
+      if (a->getErrorAt(i) != 0.0 || b->getErrorAt(i) != 0.0 ||
+          c->getErrorAt(i) != 0.0 || d->getErrorAt(i) != 0.0)
+        ++wrong;
+    }
+    TS_ASSERT_EQUALS(wrong, 0);
+  }
+
   //--------------------------------------------------------------------------------------
   void test_setUsingMask() {
     MDHistoWorkspace_sptr a, mask, c;
@@ -62,6 +62,16 @@ public:
     ws.swap(cloned);
   }
 
+  void testClone_shares_data_until_modified() {
+    Workspace2D_sptr cloned(ws->clone());
+    TS_ASSERT_EQUALS(cloned->sharedY(3), ws->sharedY(3));
+    cloned->mutableY(3)[0] = 42.0;
+    TS_ASSERT_DIFFERS(cloned->sharedY(3), ws->sharedY(3));
+    TS_ASSERT_EQUALS(cloned->y(3)[0], 42.0);
+    TS_ASSERT_DIFFERS(ws->y(3)[0], 42.0);
+    TS_ASSERT_EQUALS(cloned->sharedY(4), ws->sharedY(4));
+  }
+
   void testInit() {
     ws->setTitle("testInit");
     TS_ASSERT_EQUALS(ws->getNumberHistograms(), nhist);
@@ -81,6 +91,39 @@ public:
     }
   }
 
+  void testYView_and_eView() {
+    Workspace2D_sptr cloned(ws->clone());
+    cloned->mutableY(2)[4] = 7.0;
+    cloned->mutableE(9)[1] = 8.0;
+    const auto yView = cloned->yView();
+    const auto eView = cloned->eView();
+    TS_ASSERT_EQUALS(yView.numberOfRows(), nhist);
+    TS_ASSERT_EQUALS(yView.numberOfColumns(), nbins);
+    TS_ASSERT_EQUALS(eView.numberOfRows(), nhist);
+    TS_ASSERT_EQUALS(yView(2, 4), 7.0);
+    TS_ASSERT_EQUALS(eView(9, 1), 8.0);
+    TS_ASSERT_EQUALS(yView.row(2), &cloned->y(2)[0]);
+  }
+
+  void testMutableYView_unshares_and_writes_spectra() {
+    Workspace2D_sptr cloned(ws->clone());
+    auto yView = cloned->mutableYView();
+    auto eView = cloned->mutableEView();
+    yView(3, 0) = 11.0;
+    eView(3, 0) = 12.0;
+    TS_ASSERT_EQUALS(cloned->y(3)[0], 11.0);
+    TS_ASSERT_EQUALS(cloned->e(3)[0], 12.0);
+    TS_ASSERT_DIFFERS(ws->y(3)[0], 11.0);
+    TS_ASSERT_DIFFERS(ws->e(3)[0], 12.0);
+  }
+
+  void testViews_throw_for_unequal_bins() {
+    Workspace2D_sptr cloned(ws->clone());
+    cloned->setHistogram(0, Points(0), Counts(0));
+    TS_ASSERT_THROWS(cloned->yView(), const std::length_error &);
+    TS_ASSERT_THROWS(cloned->mutableEView(), const std::length_error &);
+  }
+
   void testUnequalBins() {
     // try normal kind first
     TS_ASSERT_EQUALS(ws->blocksize(), 5);
@@ -0,0 +1,50 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2019 ISIS Rutherford Appleton Laboratory UKRI,
+//     NScD Oak Ridge National Laboratory, European Spallation Source
+//     & Institut Laue - Langevin
+// SPDX - License - Identifier: GPL - 3.0 +
+#ifndef MANTID_GEOMETRY_INSTRUMENTCACHE_H_
+#define MANTID_GEOMETRY_INSTRUMENTCACHE_H_
+
+#include "MantidGeometry/DllConfig.h"
+#include "MantidGeometry/Instrument_fwd.h"
+#include <string>
+
+namespace Mantid {
+namespace Geometry {
+
+/** InstrumentCache : An opt-in on-disk cache of instruments built from
+  instrument definition files, so that a new process can rebuild an
+  instrument from the cache instead of parsing its definition again.
+
+  The cache is enabled by setting instrumentDefinition.cache.directory. An
+  instrument is stored under its mangled name, which includes a checksum of
+  its definition, in a versioned binary file holding the component tree, the
+  XML of its shapes and the parameters of the definition. Files written by
+  another version or revision of Mantid are not read. Instruments with
+  components the file cannot describe, such as structured detectors or a
+  separate neutronic instrument, are not cached.
+*/
+class MANTID_GEOMETRY_DLL InstrumentCache {
+public:
+  explicit InstrumentCache(const std::string &mangledName);
+
+  /// @return true if the cache directory is set
+  bool enabled() const { return !m_filename.empty(); }
+  Instrument_sptr load() const;
+  void save(const Instrument &instrument) const;
+
+  static Instrument_sptr loadFile(const std::string &filename);
+  static void saveFile(const Instrument &instrument,
+                       const std::string &filename);
+
+private:
+  /// The file caching the instrument, empty if the cache is disabled
+  std::string m_filename;
+};
+
+} // namespace Geometry
+} // namespace Mantid
+
+#endif /* MANTID_GEOMETRY_INSTRUMENTCACHE_H_ */
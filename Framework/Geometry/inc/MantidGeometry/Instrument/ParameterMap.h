@@ -219,6 +219,10 @@ public:
   boost::shared_ptr<Parameter> getRecursive(const IComponent *comp,
                                             const char *name,
                                             const char *type = "") const;
+  /// Use getRecursive() for all components of the instrument at once
+  std::vector<boost::shared_ptr<Parameter>>
+  getRecursiveForAllComponents(const std::string &name,
+                               const std::string &type = "") const;
   /// Looks recursively upwards in the component tree for the first instance of
   /// a parameter with a specified type.
   boost::shared_ptr<Parameter>
@@ -0,0 +1,67 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2019 ISIS Rutherford Appleton Laboratory UKRI,
+//     NScD Oak Ridge National Laboratory, European Spallation Source
+//     & Institut Laue - Langevin
+// SPDX - License - Identifier: GPL - 3.0 +
+#ifndef MANTID_GEOMETRY_BOUNDINGVOLUMEHIERARCHY_H_
+#define MANTID_GEOMETRY_BOUNDINGVOLUMEHIERARCHY_H_
+
+#include "MantidGeometry/DllConfig.h"
+#include "MantidKernel/V3D.h"
+#include <cstdint>
+#include <vector>
+
+namespace Mantid {
+namespace Geometry {
+
+/**
+BoundingVolumeHierarchy : A binary tree of axis-aligned boxes over the
+triangles of a mesh. Each leaf holds a few triangles and each internal node
+bounds its two children, so a ray only has to be tested against the triangles
+in the leaves whose boxes it passes through rather than against every triangle
+of the mesh.
+
+The hierarchy is built once from the triangles and vertices of a mesh and does
+not follow later changes to them.
+*/
+class MANTID_GEOMETRY_DLL BoundingVolumeHierarchy {
+public:
+  BoundingVolumeHierarchy(const std::vector<uint32_t> &triangles,
+                          const std::vector<Kernel::V3D> &vertices);
+
+  /// Append the indices of the triangles the given ray may intersect
+  void getCandidates(const Kernel::V3D &start, const Kernel::V3D &direction,
+                     std::vector<size_t> &candidates) const;
+  /// Number of boxes in the tree
+  size_t numberOfNodes() const { return m_nodes.size(); }
+
+private:
+  struct Node {
+    double minPoint[3];
+    double maxPoint[3];
+    /// Index of the first of the two children of an internal node, or of the
+    /// first triangle of a leaf in m_order
+    size_t first;
+    /// Number of triangles in a leaf, zero for an internal node
+    size_t count;
+  };
+
+  void build(const size_t nodeIndex, const size_t begin, const size_t end,
+             const std::vector<double> &triangleBoxes,
+             const std::vector<double> &centroids);
+  bool rayHitsNode(const Node &node, const Kernel::V3D &start,
+                   const Kernel::V3D &direction) const;
+
+  /// Nodes of the tree, the root first
+  std::vector<Node> m_nodes;
+  /// Triangle indices ordered so that the triangles of each leaf are adjacent
+  std::vector<size_t> m_order;
+  /// Distance the boxes are grown by so that no touching ray is missed
+  double m_padding;
+};
+
+} // namespace Geometry
+} // namespace Mantid
+
+#endif /* MANTID_GEOMETRY_BOUNDINGVOLUMEHIERARCHY_H_ */
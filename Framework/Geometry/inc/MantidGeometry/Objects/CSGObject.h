@@ -130,6 +130,15 @@ public:
 
   // INTERSECTION
   int interceptSurface(Geometry::Track &) const override;
+  /// Distance each of a batch of tracks travels inside the object
+  void distancesInside(const std::vector<Kernel::V3D> &startPoints,
+                       const std::vector<Kernel::V3D> &directions,
+                       std::vector<double> &distances) const;
+  /// Distance each of a batch of tracks travels until it first leaves the
+  /// object
+  void distancesToExit(const std::vector<Kernel::V3D> &startPoints,
+                       const std::vector<Kernel::V3D> &directions,
+                       std::vector<double> &distances) const;
 
   // Solid angle - uses triangleSolidAngle unless many (>30000) triangles
   double solidAngle(const Kernel::V3D &observer) const override;
@@ -213,6 +222,10 @@ private:
   /// Returns the volume.
   double singleShotMonteCarloVolume(const int shotSize,
                                     const size_t seed) const;
+  void trackDistances(const std::vector<Kernel::V3D> &startPoints,
+                      const std::vector<Kernel::V3D> &directions,
+                      std::vector<double> &distances,
+                      const bool firstExitOnly) const;
   /// Top rule [ Geometric scope of object]
   std::unique_ptr<Rule> TopRule;
   /// Object's bounding box
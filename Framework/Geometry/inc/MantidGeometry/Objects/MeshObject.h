@@ -12,12 +12,14 @@
 //----------------------------------------------------------------------
 #include "BoundingBox.h"
 #include "MantidGeometry/DllConfig.h"
+#include "MantidGeometry/Objects/BoundingVolumeHierarchy.h"
 #include "MantidGeometry/Objects/IObject.h"
 #include "MantidGeometry/Objects/Track.h"
 #include "MantidGeometry/Rendering/ShapeInfo.h"
 #include "MantidKernel/Material.h"
 #include <map>
 #include <memory>
+#include <mutex>
 
 namespace Mantid {
 //----------------------------------------------------------------------
@@ -150,6 +152,11 @@ private:
       std::vector<Kernel::V3D> &intersectionPoints,
       std::vector<Mantid::Geometry::TrackDirection> &entryExitFlags) const;
 
+  /// Get the hierarchy of boxes over the triangles, building it if needed
+  std::shared_ptr<const BoundingVolumeHierarchy> hierarchy() const;
+  /// Update the caches after the vertices have moved
+  void verticesMoved();
+
   /// Get triangle
   bool getTriangle(const size_t index, Kernel::V3D &v1, Kernel::V3D &v2,
                    Kernel::V3D &v3) const;
@@ -158,6 +165,10 @@ private:
 
   /// Cache for object's bounding box
   mutable BoundingBox m_boundingBox;
+  /// Hierarchy of boxes over the triangles, built on first use
+  mutable std::shared_ptr<const BoundingVolumeHierarchy> m_hierarchy;
+  /// Serialises building and replacing the hierarchy
+  mutable std::mutex m_hierarchyMutex;
 
   /// Tolerence distance
   const double M_TOLERANCE = 0.000001;
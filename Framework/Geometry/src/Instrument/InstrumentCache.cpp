@@ -0,0 +1,766 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2019 ISIS Rutherford Appleton Laboratory UKRI,
+//     NScD Oak Ridge National Laboratory, European Spallation Source
+//     & Institut Laue - Langevin
+// SPDX - License - Identifier: GPL - 3.0 +
+#include "MantidGeometry/Instrument/InstrumentCache.h"
+#include "MantidGeometry/Instrument.h"
+#include "MantidGeometry/Instrument/CompAssembly.h"
+#include "MantidGeometry/Instrument/Detector.h"
+#include "MantidGeometry/Instrument/GridDetector.h"
+#include "MantidGeometry/Instrument/ObjCompAssembly.h"
+#include "MantidGeometry/Instrument/ObjComponent.h"
+#include "MantidGeometry/Instrument/RectangularDetector.h"
+#include "MantidGeometry/Instrument/ReferenceFrame.h"
+#include "MantidGeometry/Instrument/XMLInstrumentParameter.h"
+#include "MantidGeometry/Objects/CSGObject.h"
+#include "MantidGeometry/Objects/ShapeFactory.h"
+#include "MantidKernel/ConfigService.h"
+#include "MantidKernel/Logger.h"
+#include "MantidKernel/MantidVersion.h"
+
+#include <Poco/File.h>
+#include <Poco/Path.h>
+#include <Poco/TemporaryFile.h>
+
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+using namespace Mantid::Kernel;
+using Mantid::Types::Core::DateAndTime;
+
+namespace Mantid {
+namespace Geometry {
+namespace {
+/// static logger
+Logger g_log("InstrumentCache");
+
+/// Identifies instrument cache files, written at their start and end
+const std::string MAGIC = "MantidInstrumentCache";
+/// Version of the file format, to be increased whenever it changes
+const uint32_t FORMAT_VERSION = 2;
+/// Written as is to reject files written with another byte order
+const uint32_t BYTE_ORDER = 0x01020304;
+
+/// The version and revision of Mantid, written to reject files written by
+/// another build whose parsing of definitions may differ
+std::string mantidVersion() {
+  return std::string(MantidVersion::version()) + " " +
+         MantidVersion::revisionFull();
+}
+
+/// The kinds of component stored in the cache
+enum class ComponentKind : uint8_t {
+  Component,
+  ObjComponent,
+  Detector,
+  CompAssembly,
+  ObjCompAssembly,
+  GridDetector,
+  RectangularDetector
+};
+
+/// How a detector is registered with the instrument
+enum class DetectorMark : uint8_t { None, Detector, Monitor };
+
+/// @return the kind of a component, throws if it cannot be cached
+ComponentKind kindOf(const IComponent &comp) {
+  const auto type = comp.type();
+  if (type == "LogicalComponent" && dynamic_cast<const Component *>(&comp))
+    return ComponentKind::Component;
+  if (type == "PhysicalComponent")
+    return ComponentKind::ObjComponent;
+  if (type == "DetectorComponent" || type == "GridDetectorPixel")
+    return ComponentKind::Detector;
+  if (type == "CompAssembly")
+    return ComponentKind::CompAssembly;
+  if (type == "ObjCompAssembly")
+    return ComponentKind::ObjCompAssembly;
+  if (type == "GridDetector")
+    return ComponentKind::GridDetector;
+  if (type == "RectangularDetector")
+    return ComponentKind::RectangularDetector;
+  throw std::runtime_error("Components of type " + type +
+                           " cannot be cached");
+}
+
+/// @return the axis a unit vector of a reference frame points along
+PointingAlong axisOf(const V3D &direction) {
+  if (direction.X() != 0.0)
+    return X;
+  if (direction.Y() != 0.0)
+    return Y;
+  return Z;
+}
+
+/// @return the shape of the first pixel of a detector bank
+boost::shared_ptr<const IObject> pixelShape(const ICompAssembly &assembly) {
+  for (int i = 0; i < assembly.nelements(); ++i) {
+    const auto child = assembly.getChild(i);
+    if (const auto pixel = boost::dynamic_pointer_cast<ObjComponent>(child))
+      return pixel->shape();
+    if (const auto sub = boost::dynamic_pointer_cast<ICompAssembly>(child)) {
+      if (auto shape = pixelShape(*sub))
+        return shape;
+    }
+  }
+  return nullptr;
+}
+
+/// Writes the values making up a cache file
+class CacheWriter {
+public:
+  explicit CacheWriter(std::ostream &out) : m_out(out) {}
+
+  template <typename T> void write(const T &value) {
+    static_assert(std::is_arithmetic<T>::value || std::is_enum<T>::value,
+                  "Only plain values can be written directly");
+    m_out.write(reinterpret_cast<const char *>(&value), sizeof(T));
+  }
+  void write(const std::string &value) {
+    write(static_cast<uint64_t>(value.size()));
+    m_out.write(value.data(), static_cast<std::streamsize>(value.size()));
+  }
+  void write(const V3D &value) {
+    write(value.X());
+    write(value.Y());
+    write(value.Z());
+  }
+  void write(const Quat &value) {
+    write(value.real());
+    write(value.imagI());
+    write(value.imagJ());
+    write(value.imagK());
+  }
+
+private:
+  std::ostream &m_out;
+};
+
+/// Reads the values making up a cache file
+class CacheReader {
+public:
+  explicit CacheReader(std::istream &in) : m_in(in) {
+    m_in.seekg(0, std::ios::end);
+    m_size = static_cast<uint64_t>(m_in.tellg());
+    m_in.seekg(0, std::ios::beg);
+  }
+
+  template <typename T> T read() {
+    static_assert(std::is_arithmetic<T>::value || std::is_enum<T>::value,
+                  "Only plain values can be read directly");
+    T value;
+    m_in.read(reinterpret_cast<char *>(&value), sizeof(T));
+    check();
+    return value;
+  }
+  std::string readString() {
+    const auto size = read<uint64_t>();
+    if (size > m_size)
+      throw std::runtime_error("The instrument cache file is corrupt");
+    std::string value(size, '\0');
+    m_in.read(&value[0], static_cast<std::streamsize>(size));
+    check();
+    return value;
+  }
+  V3D readV3D() {
+    const auto x = read<double>();
+    const auto y = read<double>();
+    const auto z = read<double>();
+    return V3D(x, y, z);
+  }
+  Quat readQuat() {
+    const auto w = read<double>();
+    const auto a = read<double>();
+    const auto b = read<double>();
+    const auto c = read<double>();
+    return Quat(w, a, b, c);
+  }
+
+private:
+  void check() const {
+    if (!m_in)
+      throw std::runtime_error("The instrument cache file is incomplete");
+  }
+
+  std::istream &m_in;
+  /// The size of the file, bounding the length of strings
+  uint64_t m_size;
+};
+
+/// Writes an instrument to a cache file
+class InstrumentSerializer {
+public:
+  explicit InstrumentSerializer(const Instrument &instrument)
+      : m_instrument(instrument) {}
+  void write(std::ostream &out);
+
+private:
+  void writeComponent(CacheWriter &writer, const IComponent &comp,
+                      bool generated);
+  void writeChildren(CacheWriter &writer, const ICompAssembly &assembly,
+                     bool generated);
+  void writeParameter(CacheWriter &writer,
+                      const XMLInstrumentParameter &param) const;
+  int64_t shapeIndex(const boost::shared_ptr<const IObject> &shape);
+  int64_t componentIndex(const IComponent *comp) const;
+
+  const Instrument &m_instrument;
+  std::unordered_map<const IComponent *, int64_t> m_componentIndices;
+  std::unordered_map<const IObject *, int64_t> m_shapeIndices;
+  std::vector<const CSGObject *> m_shapes;
+  std::unordered_map<const IComponent *, DetectorMark> m_marks;
+};
+
+void InstrumentSerializer::write(std::ostream &out) {
+  if (m_instrument.isParametrized())
+    throw std::runtime_error("Only base instruments can be cached");
+  if (m_instrument.getPhysicalInstrument())
+    throw std::runtime_error(
+        "Instruments with a separate neutronic instrument cannot be cached");
+  for (const auto id : m_instrument.getDetectorIDs(false)) {
+    const IComponent *det = m_instrument.getDetector(id).get();
+    m_marks[det] = m_instrument.isMonitor(id) ? DetectorMark::Monitor
+                                              : DetectorMark::Detector;
+  }
+
+  // The tree is written first to collect the shapes it uses
+  std::ostringstream tree;
+  CacheWriter treeWriter(tree);
+  m_componentIndices.emplace(&m_instrument, 0);
+  treeWriter.write(m_instrument.getRelativePos());
+  treeWriter.write(m_instrument.getRelativeRot());
+  writeChildren(treeWriter, m_instrument, false);
+
+  CacheWriter writer(out);
+  writer.write(MAGIC);
+  writer.write(FORMAT_VERSION);
+  writer.write(BYTE_ORDER);
+  writer.write(mantidVersion());
+  writer.write(m_instrument.getName());
+  writer.write(m_instrument.getFilename());
+  writer.write(m_instrument.getXmlText());
+  writer.write(m_instrument.getValidFromDate().totalNanoseconds());
+  writer.write(m_instrument.getValidToDate().totalNanoseconds());
+  writer.write(m_instrument.getDefaultView());
+  writer.write(m_instrument.getDefaultAxis());
+  const auto frame = m_instrument.getReferenceFrame();
+  writer.write(static_cast<uint8_t>(frame->pointingUp()));
+  writer.write(static_cast<uint8_t>(frame->pointingAlongBeam()));
+  writer.write(static_cast<uint8_t>(axisOf(frame->vecThetaSign())));
+  writer.write(static_cast<uint8_t>(frame->getHandedness()));
+  writer.write(frame->origin());
+
+  writer.write(static_cast<uint64_t>(m_shapes.size()));
+  for (const auto shape : m_shapes) {
+    writer.write(shape->getShapeXML());
+    writer.write(static_cast<int32_t>(shape->getName()));
+  }
+  const auto treeBytes = tree.str();
+  out.write(treeBytes.data(), static_cast<std::streamsize>(treeBytes.size()));
+
+  writer.write(componentIndex(m_instrument.getSource().get()));
+  writer.write(componentIndex(m_instrument.getSample().get()));
+  const auto &units = m_instrument.getLogfileUnit();
+  writer.write(static_cast<uint64_t>(units.size()));
+  for (const auto &unit : units) {
+    writer.write(unit.first);
+    writer.write(unit.second);
+  }
+  const auto &params = m_instrument.getLogfileCache();
+  writer.write(static_cast<uint64_t>(params.size()));
+  for (const auto &param : params) {
+    writer.write(param.first.first);
+    writer.write(componentIndex(param.first.second));
+    writeParameter(writer, *param.second);
+  }
+  writer.write(MAGIC);
+}
+
+/**
+ * Write a component and its children. Generated components, the pixels of
+ * detector banks, are recreated with their bank so only their position,
+ * rotation and registration with the instrument are needed.
+ */
+void InstrumentSerializer::writeComponent(CacheWriter &writer,
+                                          const IComponent &comp,
+                                          bool generated) {
+  const auto kind = kindOf(comp);
+  m_componentIndices.emplace(&comp,
+                             static_cast<int64_t>(m_componentIndices.size()));
+  writer.write(kind);
+  if (!generated)
+    writer.write(comp.getName());
+  writer.write(comp.getRelativePos());
+  writer.write(comp.getRelativeRot());
+  switch (kind) {
+  case ComponentKind::Component:
+    break;
+  case ComponentKind::ObjComponent:
+    writer.write(shapeIndex(dynamic_cast<const ObjComponent &>(comp).shape()));
+    break;
+  case ComponentKind::Detector: {
+    const auto &det = dynamic_cast<const Detector &>(comp);
+    writer.write(static_cast<int32_t>(det.getID()));
+    writer.write(shapeIndex(det.shape()));
+    const auto mark = m_marks.find(&comp);
+    writer.write(mark == m_marks.cend() ? DetectorMark::None : mark->second);
+    break;
+  }
+  case ComponentKind::CompAssembly:
+    writeChildren(writer, dynamic_cast<const ICompAssembly &>(comp),
+                  generated);
+    break;
+  case ComponentKind::ObjCompAssembly:
+    writer.write(shapeIndex(dynamic_cast<const ObjComponent &>(comp).shape()));
+    writeChildren(writer, dynamic_cast<const ICompAssembly &>(comp),
+                  generated);
+    break;
+  case ComponentKind::GridDetector:
+  case ComponentKind::RectangularDetector: {
+    const auto &bank = dynamic_cast<const GridDetector &>(comp);
+    writer.write(shapeIndex(pixelShape(bank)));
+    writer.write(static_cast<int32_t>(bank.xpixels()));
+    writer.write(bank.xstart());
+    writer.write(bank.xstep());
+    writer.write(static_cast<int32_t>(bank.ypixels()));
+    writer.write(bank.ystart());
+    writer.write(bank.ystep());
+    writer.write(static_cast<int32_t>(bank.zpixels()));
+    writer.write(bank.zstart());
+    writer.write(bank.zstep());
+    writer.write(static_cast<int32_t>(bank.idstart()));
+    writer.write(bank.idFillOrder());
+    writer.write(static_cast<int32_t>(bank.idstepbyrow()));
+    writer.write(static_cast<int32_t>(bank.idstep()));
+    writeChildren(writer, bank, true);
+    break;
+  }
+  }
+}
+
+void InstrumentSerializer::writeChildren(CacheWriter &writer,
+                                         const ICompAssembly &assembly,
+                                         bool generated) {
+  writer.write(static_cast<uint64_t>(assembly.nelements()));
+  for (int i = 0; i < assembly.nelements(); ++i)
+    writeComponent(writer, *assembly.getChild(i), generated);
+}
+
+void InstrumentSerializer::writeParameter(
+    CacheWriter &writer, const XMLInstrumentParameter &param) const {
+  writer.write(param.m_logfileID);
+  writer.write(param.m_value);
+  writer.write(param.m_paramName);
+  writer.write(param.m_type);
+  writer.write(param.m_tie);
+  writer.write(static_cast<uint64_t>(param.m_constraint.size()));
+  for (const auto &constraint : param.m_constraint)
+    writer.write(constraint);
+  writer.write(param.m_penaltyFactor);
+  writer.write(param.m_fittingFunction);
+  writer.write(param.m_formula);
+  writer.write(param.m_formulaUnit);
+  writer.write(param.m_resultUnit);
+  writer.write(static_cast<uint8_t>(param.m_interpolation != nullptr));
+  if (param.m_interpolation) {
+    std::ostringstream interpolation;
+    interpolation.precision(17);
+    param.m_interpolation->printSelf(interpolation);
+    writer.write(interpolation.str());
+  }
+  writer.write(param.m_extractSingleValueAs);
+  writer.write(param.m_eq);
+  writer.write(componentIndex(param.m_component));
+  writer.write(param.m_angleConvertConst);
+  writer.write(param.m_description);
+}
+
+/// @return the index of a shape in the file, -1 for no shape
+int64_t InstrumentSerializer::shapeIndex(
+    const boost::shared_ptr<const IObject> &shape) {
+  if (!shape)
+    return -1;
+  const auto existing = m_shapeIndices.find(shape.get());
+  if (existing != m_shapeIndices.cend())
+    return existing->second;
+  const auto csgShape = dynamic_cast<const CSGObject *>(shape.get());
+  if (!csgShape || csgShape->getShapeXML().empty())
+    throw std::runtime_error("Only shapes defined in XML can be cached");
+  const auto index = static_cast<int64_t>(m_shapes.size());
+  m_shapes.emplace_back(csgShape);
+  m_shapeIndices.emplace(shape.get(), index);
+  return index;
+}
+
+/// @return the index of a component in the file, -1 for no component
+int64_t InstrumentSerializer::componentIndex(const IComponent *comp) const {
+  if (!comp)
+    return -1;
+  const auto index = m_componentIndices.find(comp);
+  if (index == m_componentIndices.cend())
+    throw std::runtime_error(
+        "The instrument refers to a component outside its tree");
+  return index->second;
+}
+
+/// Rebuilds an instrument from a cache file
+class InstrumentDeserializer {
+public:
+  explicit InstrumentDeserializer(std::istream &in) : m_reader(in) {}
+  Instrument_sptr read();
+
+private:
+  void readComponent(ICompAssembly &parent, IComponent *generated);
+  void readChildren(ICompAssembly &assembly, bool generated);
+  boost::shared_ptr<XMLInstrumentParameter> readParameter();
+  boost::shared_ptr<CSGObject> readShape();
+  IComponent *readComponentIndex();
+
+  CacheReader m_reader;
+  std::vector<boost::shared_ptr<CSGObject>> m_shapes;
+  std::vector<IComponent *> m_components;
+  std::vector<const IDetector *> m_detectors;
+  std::vector<const IDetector *> m_monitors;
+};
+
+Instrument_sptr InstrumentDeserializer::read() {
+  if (m_reader.readString() != MAGIC ||
+      m_reader.read<uint32_t>() != FORMAT_VERSION ||
+      m_reader.read<uint32_t>() != BYTE_ORDER)
+    throw std::runtime_error("Not an instrument cache file of this version");
+  if (m_reader.readString() != mantidVersion())
+    throw std::runtime_error(
+        "The instrument cache file was written by another version of Mantid");
+
+  auto instrument = boost::make_shared<Instrument>(m_reader.readString());
+  instrument->setFilename(m_reader.readString());
+  instrument->setXmlText(m_reader.readString());
+  const DateAndTime validFrom(m_reader.read<int64_t>());
+  const DateAndTime validTo(m_reader.read<int64_t>());
+  if (validFrom != instrument->getValidFromDate())
+    instrument->setValidFromDate(validFrom);
+  instrument->setValidToDate(validTo);
+  const auto defaultView = m_reader.readString();
+  if (defaultView != instrument->getDefaultView())
+    instrument->setDefaultView(defaultView);
+  instrument->setDefaultViewAxis(m_reader.readString());
+  const auto up = static_cast<PointingAlong>(m_reader.read<uint8_t>());
+  const auto alongBeam = static_cast<PointingAlong>(m_reader.read<uint8_t>());
+  const auto thetaSign = static_cast<PointingAlong>(m_reader.read<uint8_t>());
+  const auto handedness = static_cast<Handedness>(m_reader.read<uint8_t>());
+  instrument->setReferenceFrame(boost::make_shared<ReferenceFrame>(
+      up, alongBeam, thetaSign, handedness, m_reader.readString()));
+
+  ShapeFactory shapeFactory;
+  const auto numShapes = m_reader.read<uint64_t>();
+  for (uint64_t i = 0; i < numShapes; ++i) {
+    auto shape = shapeFactory.createShape(m_reader.readString(), false);
+    shape->setName(m_reader.read<int32_t>());
+    m_shapes.emplace_back(std::move(shape));
+  }
+
+  m_components.emplace_back(instrument.get());
+  instrument->setPos(m_reader.readV3D());
+  instrument->setRot(m_reader.readQuat());
+  readChildren(*instrument, false);
+  for (const auto det : m_detectors)
+    instrument->markAsDetectorIncomplete(det);
+  instrument->markAsDetectorFinalize();
+  for (const auto monitor : m_monitors)
+    instrument->markAsMonitor(monitor);
+  if (const auto source = readComponentIndex())
+    instrument->markAsSource(source);
+  if (const auto sample = readComponentIndex())
+    instrument->markAsSamplePos(sample);
+
+  auto &units = instrument->getLogfileUnit();
+  const auto numUnits = m_reader.read<uint64_t>();
+  for (uint64_t i = 0; i < numUnits; ++i) {
+    auto name = m_reader.readString();
+    units[name] = m_reader.readString();
+  }
+  auto &params = instrument->getLogfileCache();
+  const auto numParams = m_reader.read<uint64_t>();
+  for (uint64_t i = 0; i < numParams; ++i) {
+    auto name = m_reader.readString();
+    const auto comp = readComponentIndex();
+    params.emplace(std::make_pair(std::move(name), comp), readParameter());
+  }
+  if (m_reader.readString() != MAGIC)
+    throw std::runtime_error("The instrument cache file is corrupt");
+  return instrument;
+}
+
+/**
+ * Read a component and its children, creating it in the parent assembly
+ * unless it was generated with its detector bank.
+ * @param parent :: the assembly to add the component to
+ * @param generated :: the component generated with its bank, or nullptr
+ */
+void InstrumentDeserializer::readComponent(ICompAssembly &parent,
+                                           IComponent *generated) {
+  const auto kind = m_reader.read<ComponentKind>();
+  const auto name = generated ? generated->getName() : m_reader.readString();
+  const auto pos = m_reader.readV3D();
+  const auto rot = m_reader.readQuat();
+  if (generated && kindOf(*generated) != kind)
+    throw std::runtime_error("The pixels of the cached instrument differ "
+                             "from those of its detector banks");
+
+  IComponent *comp = generated;
+  ICompAssembly *assembly = nullptr;
+  bool generatedChildren = generated != nullptr;
+  switch (kind) {
+  case ComponentKind::Component:
+    if (!comp) {
+      comp = new Component(name, &parent);
+      parent.add(comp);
+    }
+    break;
+  case ComponentKind::ObjComponent: {
+    const auto shape = readShape();
+    if (!comp) {
+      comp = new ObjComponent(name, shape, &parent);
+      parent.add(comp);
+    }
+    break;
+  }
+  case ComponentKind::Detector: {
+    const auto id = m_reader.read<int32_t>();
+    const auto shape = readShape();
+    const auto mark = m_reader.read<DetectorMark>();
+    IDetector *det = dynamic_cast<IDetector *>(comp);
+    if (det && det->getID() != id)
+      throw std::runtime_error("The detector IDs of the cached instrument "
+                               "differ from those of its detector banks");
+    if (!det) {
+      det = new Detector(name, id, shape, &parent);
+      comp = det;
+      parent.add(comp);
+    }
+    if (mark == DetectorMark::Detector)
+      m_detectors.emplace_back(det);
+    else if (mark == DetectorMark::Monitor)
+      m_monitors.emplace_back(det);
+    break;
+  }
+  case ComponentKind::CompAssembly:
+    if (!comp) {
+      comp = new CompAssembly(name, &parent);
+      parent.add(comp);
+    }
+    assembly = dynamic_cast<ICompAssembly *>(comp);
+    break;
+  case ComponentKind::ObjCompAssembly: {
+    const auto shape = readShape();
+    if (!comp) {
+      auto objAssembly = new ObjCompAssembly(name, &parent);
+      parent.add(objAssembly);
+      objAssembly->setOutline(shape);
+      comp = objAssembly;
+    }
+    assembly = dynamic_cast<ICompAssembly *>(comp);
+    break;
+  }
+  case ComponentKind::GridDetector:
+  case ComponentKind::RectangularDetector: {
+    const auto shape = readShape();
+    const auto xpixels = m_reader.read<int32_t>();
+    const auto xstart = m_reader.read<double>();
+    const auto xstep = m_reader.read<double>();
+    const auto ypixels = m_reader.read<int32_t>();
+    const auto ystart = m_reader.read<double>();
+    const auto ystep = m_reader.read<double>();
+    const auto zpixels = m_reader.read<int32_t>();
+    const auto zstart = m_reader.read<double>();
+    const auto zstep = m_reader.read<double>();
+    const auto idstart = m_reader.read<int32_t>();
+    const auto idFillOrder = m_reader.readString();
+    const auto idstepbyrow = m_reader.read<int32_t>();
+    const auto idstep = m_reader.read<int32_t>();
+    if (!comp) {
+      GridDetector *bank = kind == ComponentKind::GridDetector
+                               ? new GridDetector(name, &parent)
+                               : new RectangularDetector(name, &parent);
+      parent.add(bank);
+      bank->initialize(shape, xpixels, xstart, xstep, ypixels, ystart, ystep,
+                       zpixels, zstart, zstep, idstart, idFillOrder,
+                       idstepbyrow, idstep);
+      comp = bank;
+    }
+    assembly = dynamic_cast<ICompAssembly *>(comp);
+    generatedChildren = true;
+    break;
+  }
+  default:
+    throw std::runtime_error("The instrument cache file is corrupt");
+  }
+  comp->setPos(pos);
+  comp->setRot(rot);
+  m_components.emplace_back(comp);
+  if (assembly)
+    readChildren(*assembly, generatedChildren);
+}
+
+void InstrumentDeserializer::readChildren(ICompAssembly &assembly,
+                                          bool generated) {
+  const auto numChildren = m_reader.read<uint64_t>();
+  if (generated && numChildren != static_cast<uint64_t>(assembly.nelements()))
+    throw std::runtime_error("The pixels of the cached instrument differ "
+                             "from those of its detector banks");
+  for (uint64_t i = 0; i < numChildren; ++i) {
+    readComponent(assembly,
+                  generated ? assembly.getChild(static_cast<int>(i)).get()
+                            : nullptr);
+  }
+}
+
+boost::shared_ptr<XMLInstrumentParameter>
+InstrumentDeserializer::readParameter() {
+  const auto logfileID = m_reader.readString();
+  const auto value = m_reader.readString();
+  const auto paramName = m_reader.readString();
+  const auto type = m_reader.readString();
+  const auto tie = m_reader.readString();
+  std::vector<std::string> constraint;
+  const auto numConstraints = m_reader.read<uint64_t>();
+  for (uint64_t i = 0; i < numConstraints; ++i)
+    constraint.emplace_back(m_reader.readString());
+  auto penaltyFactor = m_reader.readString();
+  const auto fitFunc = m_reader.readString();
+  const auto formula = m_reader.readString();
+  const auto formulaUnit = m_reader.readString();
+  const auto resultUnit = m_reader.readString();
+  boost::shared_ptr<Interpolation> interpolation;
+  if (m_reader.read<uint8_t>()) {
+    interpolation = boost::make_shared<Interpolation>();
+    std::istringstream points(m_reader.readString());
+    points >> *interpolation;
+  }
+  const auto extractSingleValueAs = m_reader.readString();
+  const auto eq = m_reader.readString();
+  const auto comp = readComponentIndex();
+  const auto angleConvertConst = m_reader.read<double>();
+  const auto description = m_reader.readString();
+  return boost::make_shared<XMLInstrumentParameter>(
+      logfileID, value, interpolation, formula, formulaUnit, resultUnit,
+      paramName, type, tie, constraint, penaltyFactor, fitFunc,
+      extractSingleValueAs, eq, comp, angleConvertConst, description);
+}
+
+boost::shared_ptr<CSGObject> InstrumentDeserializer::readShape() {
+  const auto index = m_reader.read<int64_t>();
+  if (index < 0)
+    return nullptr;
+  if (static_cast<uint64_t>(index) >= m_shapes.size())
+    throw std::runtime_error("The instrument cache file is corrupt");
+  return m_shapes[index];
+}
+
+IComponent *InstrumentDeserializer::readComponentIndex() {
+  const auto index = m_reader.read<int64_t>();
+  if (index < 0)
+    return nullptr;
+  if (static_cast<uint64_t>(index) >= m_components.size())
+    throw std::runtime_error("The instrument cache file is corrupt");
+  return m_components[index];
+}
+} // namespace
+
+/**
+ * @param mangledName :: the mangled name of the instrument, which includes a
+ * checksum of its definition
+ */
+InstrumentCache::InstrumentCache(const std::string &mangledName) {
+  const auto directory = ConfigService::Instance().getString(
+      "instrumentDefinition.cache.directory");
+  if (directory.empty() || mangledName.empty())
+    return;
+  Poco::Path path(directory);
+  path.makeDirectory();
+  path.setFileName(mangledName + ".instrument");
+  m_filename = path.toString();
+}
+
+/**
+ * Rebuild the instrument from the cache.
+ * @return the instrument, or nullptr if it is not in the cache
+ */
+Instrument_sptr InstrumentCache::load() const {
+  if (!enabled() || !Poco::File(m_filename).exists())
+    return nullptr;
+  try {
+    auto instrument = loadFile(m_filename);
+    g_log.information() << "Read instrument " << instrument->getName()
+                        << " from the instrument cache\n";
+    return instrument;
+  } catch (std::exception &ex) {
+    g_log.warning() << "Could not read the instrument cache file "
+                    << m_filename << ": " << ex.what() << "\n";
+    return nullptr;
+  }
+}
+
+/**
+ * Store an instrument just built from its definition in the cache. Nothing
+ * is stored if the cache cannot describe the instrument.
+ * @param instrument :: the instrument to store
+ */
+void InstrumentCache::save(const Instrument &instrument) const {
+  if (!enabled())
+    return;
+  std::string tempFilename;
+  try {
+    const auto directory = Poco::Path(m_filename).parent().toString();
+    Poco::File(directory).createDirectories();
+    // Write to a temporary file first so that other processes sharing the
+    // cache never read an incomplete file
+    tempFilename = Poco::TemporaryFile::tempName(directory);
+    saveFile(instrument, tempFilename);
+    Poco::File(tempFilename).renameTo(m_filename);
+  } catch (std::exception &ex) {
+    g_log.information() << "Did not store instrument " << instrument.getName()
+                        << " in the instrument cache: " << ex.what() << "\n";
+    if (!tempFilename.empty() && Poco::File(tempFilename).exists())
+      Poco::File(tempFilename).remove();
+  }
+}
+
+/**
+ * Rebuild an instrument from a cache file.
+ * @param filename :: the path of the file
+ * @return the instrument
+ * @throws std::runtime_error if the file is not a valid cache file
+ */
+Instrument_sptr InstrumentCache::loadFile(const std::string &filename) {
+  std::ifstream in(filename, std::ios::binary);
+  if (!in)
+    throw std::runtime_error("Could not open " + filename);
+  return InstrumentDeserializer(in).read();
+}
+
+/**
+ * Write an instrument to a cache file.
+ * @param instrument :: the instrument, as built from its definition
+ * @param filename :: the path of the file
+ * @throws std::runtime_error if the instrument cannot be cached
+ */
+void InstrumentCache::saveFile(const Instrument &instrument,
+                               const std::string &filename) {
+  std::ostringstream content;
+  InstrumentSerializer(instrument).write(content);
+  std::ofstream out(filename, std::ios::binary);
+  const auto bytes = content.str();
+  out.write(bytes.data(), static_cast<std::streamsize>(bytes.size()));
+  if (!out)
+    throw std::runtime_error("Could not write " + filename);
+}
+
+} // namespace Geometry
+} // namespace Mantid
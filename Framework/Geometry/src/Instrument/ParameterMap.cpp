@@ -962,6 +962,36 @@ Parameter_sptr ParameterMap::getRecursive(const IComponent *comp,
   return result;
 }
 
+/**
+ * Find a parameter by name for every component of the instrument, going up
+ * the component tree to higher parents like getRecursive. Each component is
+ * looked up in the map once, instead of once for every component below it, so
+ * this is much faster than calling getRecursive for every detector.
+ * @param name :: Parameter name
+ * @param type :: An optional type string
+ * @returns the first matching parameter of each component, or a NULL shared
+ * pointer if there is none, indexed by component index. The detectors come
+ * first, so the parameter of a detector is at its detector index.
+ * @throws std::runtime_error if the map has no ComponentInfo
+ */
+std::vector<Parameter_sptr>
+ParameterMap::getRecursiveForAllComponents(const std::string &name,
+                                           const std::string &type) const {
+  checkIsNotMaskingParameter(name);
+  const auto &compInfo = componentInfo();
+  std::vector<Parameter_sptr> result(compInfo.size());
+  if (m_map.empty())
+    return result;
+  // Assemblies are indexed after their children, so going backwards the
+  // parameter of the parent of a component is already known
+  for (size_t i = result.size(); i-- > 0;) {
+    result[i] = get(compInfo.componentID(i), name.c_str(), type.c_str());
+    if (!result[i] && compInfo.hasParent(i))
+      result[i] = result[compInfo.parent(i)];
+  }
+  return result;
+}
+
 /**
  * Return the value of a parameter as a string
  * @param comp :: Component to which parameter is related
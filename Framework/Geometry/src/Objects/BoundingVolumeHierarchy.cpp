@@ -0,0 +1,202 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2019 ISIS Rutherford Appleton Laboratory UKRI,
+//     NScD Oak Ridge National Laboratory, European Spallation Source
+//     & Institut Laue - Langevin
+// SPDX - License - Identifier: GPL - 3.0 +
+#include "MantidGeometry/Objects/BoundingVolumeHierarchy.h"
+
+#include <algorithm>
+#include <limits>
+#include <numeric>
+
+namespace Mantid {
+namespace Geometry {
+
+namespace {
+/// Largest number of triangles kept in a leaf
+constexpr size_t LEAF_SIZE = 4;
+/// Size of the boxes relative to the whole mesh they are grown by. This is
+/// larger than the tolerance used when intersecting a ray with a triangle.
+constexpr double RELATIVE_PADDING = 1e-6;
+} // namespace
+
+/**
+ * Build the hierarchy over the given triangles
+ * @param triangles :: Indices into vertices, three for each triangle
+ * @param vertices :: Vertices of the mesh
+ */
+BoundingVolumeHierarchy::BoundingVolumeHierarchy(
+    const std::vector<uint32_t> &triangles,
+    const std::vector<Kernel::V3D> &vertices)
+    : m_padding(0.0) {
+  const size_t numberOfTriangles = triangles.size() / 3;
+  if (numberOfTriangles == 0)
+    return;
+
+  // Box and centroid of every triangle
+  std::vector<double> triangleBoxes(6 * numberOfTriangles);
+  std::vector<double> centroids(3 * numberOfTriangles);
+  double meshMin[3], meshMax[3];
+  std::fill(meshMin, meshMin + 3, std::numeric_limits<double>::max());
+  std::fill(meshMax, meshMax + 3, std::numeric_limits<double>::lowest());
+  for (size_t i = 0; i < numberOfTriangles; ++i) {
+    const auto &v1 = vertices[triangles[3 * i]];
+    const auto &v2 = vertices[triangles[3 * i + 1]];
+    const auto &v3 = vertices[triangles[3 * i + 2]];
+    for (size_t axis = 0; axis < 3; ++axis) {
+      const double low = std::min({v1[axis], v2[axis], v3[axis]});
+      const double high = std::max({v1[axis], v2[axis], v3[axis]});
+      triangleBoxes[6 * i + axis] = low;
+      triangleBoxes[6 * i + 3 + axis] = high;
+      centroids[3 * i + axis] = (v1[axis] + v2[axis] + v3[axis]) / 3.0;
+      meshMin[axis] = std::min(meshMin[axis], low);
+      meshMax[axis] = std::max(meshMax[axis], high);
+    }
+  }
+  const Kernel::V3D diagonal(meshMax[0] - meshMin[0], meshMax[1] - meshMin[1],
+                             meshMax[2] - meshMin[2]);
+  m_padding = RELATIVE_PADDING * diagonal.norm();
+
+  m_order.resize(numberOfTriangles);
+  std::iota(m_order.begin(), m_order.end(), 0);
+  // A binary tree with at least one triangle per leaf never has more nodes
+  m_nodes.reserve(2 * numberOfTriangles - 1);
+  m_nodes.emplace_back();
+  build(0, 0, numberOfTriangles, triangleBoxes, centroids);
+}
+
+/**
+ * Find the triangles whose boxes the ray passes through. Triangles behind the
+ * start of the ray are left out. A triangle may be listed even if the ray
+ * misses it but none the ray intersects is left out.
+ * @param start :: Start point of the ray
+ * @param direction :: Unit vector along the ray
+ * @param candidates :: Output, triangle indices are appended
+ */
+void BoundingVolumeHierarchy::getCandidates(
+    const Kernel::V3D &start, const Kernel::V3D &direction,
+    std::vector<size_t> &candidates) const {
+  if (m_nodes.empty())
+    return;
+  std::vector<size_t> stack{0};
+  while (!stack.empty()) {
+    const Node &node = m_nodes[stack.back()];
+    stack.pop_back();
+    if (!rayHitsNode(node, start, direction))
+      continue;
+    if (node.count > 0) {
+      candidates.insert(candidates.end(), m_order.begin() + node.first,
+                        m_order.begin() + node.first + node.count);
+    } else {
+      stack.emplace_back(node.first);
+      stack.emplace_back(node.first + 1);
+    }
+  }
+}
+
+/**
+ * Set the box of a node and split its triangles between two children at the
+ * median centroid along the longest side, until few enough are left for a
+ * leaf.
+ * @param nodeIndex :: Index of the node in m_nodes
+ * @param begin :: Index in m_order of the first triangle of the node
+ * @param end :: Index in m_order after the last triangle of the node
+ * @param triangleBoxes :: Low and high corners of the box of every triangle
+ * @param centroids :: Centroid of every triangle
+ */
+void BoundingVolumeHierarchy::build(const size_t nodeIndex, const size_t begin,
+                                    const size_t end,
+                                    const std::vector<double> &triangleBoxes,
+                                    const std::vector<double> &centroids) {
+  Node &node = m_nodes[nodeIndex];
+  double centroidMin[3], centroidMax[3];
+  for (size_t axis = 0; axis < 3; ++axis) {
+    node.minPoint[axis] = centroidMin[axis] =
+        std::numeric_limits<double>::max();
+    node.maxPoint[axis] = centroidMax[axis] =
+        std::numeric_limits<double>::lowest();
+  }
+  for (size_t i = begin; i < end; ++i) {
+    const size_t triangle = m_order[i];
+    for (size_t axis = 0; axis < 3; ++axis) {
+      node.minPoint[axis] =
+          std::min(node.minPoint[axis], triangleBoxes[6 * triangle + axis]);
+      node.maxPoint[axis] =
+          std::max(node.maxPoint[axis], triangleBoxes[6 * triangle + 3 + axis]);
+      centroidMin[axis] =
+          std::min(centroidMin[axis], centroids[3 * triangle + axis]);
+      centroidMax[axis] =
+          std::max(centroidMax[axis], centroids[3 * triangle + axis]);
+    }
+  }
+  for (size_t axis = 0; axis < 3; ++axis) {
+    node.minPoint[axis] -= m_padding;
+    node.maxPoint[axis] += m_padding;
+  }
+
+  if (end - begin <= LEAF_SIZE) {
+    node.first = begin;
+    node.count = end - begin;
+    return;
+  }
+
+  size_t splitAxis = 0;
+  for (size_t axis = 1; axis < 3; ++axis) {
+    if (centroidMax[axis] - centroidMin[axis] >
+        centroidMax[splitAxis] - centroidMin[splitAxis])
+      splitAxis = axis;
+  }
+  const size_t middle = begin + (end - begin) / 2;
+  std::nth_element(m_order.begin() + begin, m_order.begin() + middle,
+                   m_order.begin() + end,
+                   [&centroids, splitAxis](size_t a, size_t b) {
+                     return centroids[3 * a + splitAxis] <
+                            centroids[3 * b + splitAxis];
+                   });
+
+  const size_t left = m_nodes.size();
+  node.first = left;
+  node.count = 0;
+  // Space was reserved up front so node stays valid
+  m_nodes.emplace_back();
+  m_nodes.emplace_back();
+  build(left, begin, middle, triangleBoxes, centroids);
+  build(left + 1, middle, end, triangleBoxes, centroids);
+}
+
+/**
+ * Test a ray against the box of a node with the slab method
+ * @param node :: The node to test
+ * @param start :: Start point of the ray
+ * @param direction :: Unit vector along the ray
+ * @returns true if the ray passes through or touches the box
+ */
+bool BoundingVolumeHierarchy::rayHitsNode(const Node &node,
+                                          const Kernel::V3D &start,
+                                          const Kernel::V3D &direction) const {
+  double tNear = std::numeric_limits<double>::lowest();
+  double tFar = std::numeric_limits<double>::max();
+  for (size_t axis = 0; axis < 3; ++axis) {
+    const double origin = start[axis];
+    const double step = direction[axis];
+    if (step == 0.0) {
+      if (origin < node.minPoint[axis] || origin > node.maxPoint[axis])
+        return false;
+      continue;
+    }
+    double t1 = (node.minPoint[axis] - origin) / step;
+    double t2 = (node.maxPoint[axis] - origin) / step;
+    if (t1 > t2)
+      std::swap(t1, t2);
+    tNear = std::max(tNear, t1);
+    tFar = std::min(tFar, t2);
+    if (tNear > tFar)
+      return false;
+  }
+  // The triangle test accepts points just behind the start of the ray
+  return tFar >= -m_padding;
+}
+
+} // namespace Geometry
+} // namespace Mantid
@@ -16,6 +16,7 @@
 #include "MantidGeometry/Surfaces/Cone.h"
 #include "MantidGeometry/Surfaces/Cylinder.h"
 #include "MantidGeometry/Surfaces/LineIntersectVisit.h"
+#include "MantidGeometry/Surfaces/Quadratic.h"
 #include "MantidGeometry/Surfaces/Surface.h"
 #include "MantidKernel/Exception.h"
 #include "MantidKernel/Logger.h"
@@ -1124,6 +1125,150 @@ int CSGObject::interceptSurface(Geometry::Track &UT) const {
   return (UT.count() - originalCount);
 }
 
+/**
+ * Find the distance each of a batch of tracks travels inside the object. This
+ * gives the same lengths as adding up the links interceptSurface fills in for
+ * each track but without building the tracks. The surface equations are
+ * gathered once for the whole batch and the rule tree is tested once at the
+ * middle of each section of a track between two surfaces, rather than either
+ * side of every intersection.
+ * @param startPoints :: Start point of each track
+ * @param directions :: Unit vector along each track
+ * @param distances :: Output, the distance inside the object along each track
+ */
+void CSGObject::distancesInside(const std::vector<Kernel::V3D> &startPoints,
+                                const std::vector<Kernel::V3D> &directions,
+                                std::vector<double> &distances) const {
+  trackDistances(startPoints, directions, distances, false);
+}
+
+/**
+ * Find the distance along each of a batch of tracks to the point where it
+ * first leaves the object. This is the distFromStart of the first link
+ * interceptSurface fills in for each track, found as in distancesInside.
+ * @param startPoints :: Start point of each track
+ * @param directions :: Unit vector along each track
+ * @param distances :: Output, the distance to the first exit along each
+ * track, zero if the track does not pass through the object
+ */
+void CSGObject::distancesToExit(const std::vector<Kernel::V3D> &startPoints,
+                                const std::vector<Kernel::V3D> &directions,
+                                std::vector<double> &distances) const {
+  trackDistances(startPoints, directions, distances, true);
+}
+
+/**
+ * Find the distances along a batch of tracks for distancesInside and
+ * distancesToExit
+ * @param startPoints :: Start point of each track
+ * @param directions :: Unit vector along each track
+ * @param distances :: Output, the distance along each track
+ * @param firstExitOnly :: If true find the distance to the end of the first
+ * section inside the object, otherwise the total length inside it
+ */
+void CSGObject::trackDistances(const std::vector<Kernel::V3D> &startPoints,
+                               const std::vector<Kernel::V3D> &directions,
+                               std::vector<double> &distances,
+                               const bool firstExitOnly) const {
+  if (startPoints.size() != directions.size()) {
+    throw std::invalid_argument("CSGObject::trackDistances - number of start "
+                                "points and directions do not match");
+  }
+  const size_t numberOfTracks = startPoints.size();
+  distances.assign(numberOfTracks, 0.0);
+  if (!TopRule)
+    return;
+
+  // Gather the coefficients of the surface equations, each as an array over
+  // the surfaces
+  const size_t nSurfaces = m_SurList.size();
+  std::vector<double> equations(10 * nSurfaces);
+  for (size_t i = 0; i < nSurfaces; ++i) {
+    const auto quadric = dynamic_cast<const Quadratic *>(m_SurList[i]);
+    if (!quadric) {
+      // Only quadric surfaces can be gathered so trace the tracks one by one
+      for (size_t j = 0; j < numberOfTracks; ++j) {
+        Track track(startPoints[j], directions[j]);
+        interceptSurface(track);
+        if (firstExitOnly) {
+          if (track.count() > 0)
+            distances[j] = track.cbegin()->distFromStart;
+          continue;
+        }
+        for (const auto &link : track)
+          distances[j] += link.distInsideObject;
+      }
+      return;
+    }
+    const auto &baseEqn = quadric->copyBaseEqn();
+    for (size_t k = 0; k < 10; ++k)
+      equations[k * nSurfaces + i] = baseEqn[k];
+  }
+  const double *eqn = equations.data();
+
+  std::vector<double> quadratic(3 * nSurfaces);
+  double *a = quadratic.data();
+  double *b = a + nSurfaces;
+  double *c = b + nSurfaces;
+  std::vector<double> crossings;
+  for (size_t j = 0; j < numberOfTracks; ++j) {
+    const Kernel::V3D &start = startPoints[j];
+    const Kernel::V3D &direction = directions[j];
+    const double x(start[0]), y(start[1]), z(start[2]);
+    const double u(direction[0]), v(direction[1]), w(direction[2]);
+    // Substituting the track into each surface gives a quadratic in the
+    // distance along it, as in Line::intersect
+    for (size_t i = 0; i < nSurfaces; ++i) {
+      double k[10];
+      for (size_t m = 0; m < 10; ++m)
+        k[m] = eqn[m * nSurfaces + i];
+      a[i] = k[0] * u * u + k[1] * v * v + k[2] * w * w + k[3] * u * v +
+             k[4] * u * w + k[5] * v * w;
+      b[i] = 2 * k[0] * x * u + 2 * k[1] * y * v + 2 * k[2] * z * w +
+             k[3] * (x * v + y * u) + k[4] * (x * w + z * u) +
+             k[5] * (y * w + z * v) + k[6] * u + k[7] * v + k[8] * w;
+      c[i] = k[0] * x * x + k[1] * y * y + k[2] * z * z + k[3] * x * y +
+             k[4] * x * z + k[5] * y * z + k[6] * x + k[7] * y + k[8] * z +
+             k[9];
+    }
+
+    crossings.clear();
+    for (size_t i = 0; i < nSurfaces; ++i) {
+      if (a[i] == 0.0) {
+        if (b[i] != 0.0 && -c[i] / b[i] > 0.0)
+          crossings.emplace_back(-c[i] / b[i]);
+        continue;
+      }
+      const double discriminant = b[i] * b[i] - 4 * a[i] * c[i];
+      if (discriminant < 0.0)
+        continue;
+      const double root = std::sqrt(discriminant);
+      const double q =
+          (b[i] >= 0) ? -0.5 * (b[i] + root) : -0.5 * (b[i] - root);
+      if (q / a[i] > 0.0)
+        crossings.emplace_back(q / a[i]);
+      if (q != 0.0 && c[i] / q > 0.0)
+        crossings.emplace_back(c[i] / q);
+    }
+    std::sort(crossings.begin(), crossings.end());
+
+    // Sections between crossings are either wholly inside or outside
+    double previous(0.0), inside(0.0), exit(0.0);
+    for (const double distance : crossings) {
+      if (distance - previous < Kernel::Tolerance)
+        continue;
+      if (isValid(start + direction * (0.5 * (previous + distance)))) {
+        inside += distance - previous;
+        exit = distance;
+      } else if (firstExitOnly && exit > 0.0) {
+        break;
+      }
+      previous = distance;
+    }
+    distances[j] = firstExitOnly ? exit : inside;
+  }
+}
+
 /**
  * Calculate if a point PT is a valid point on the track
  * @param point :: Point to calculate from.
@@ -179,9 +179,14 @@ void MeshObject::getIntersections(
     std::vector<Kernel::V3D> &intersectionPoints,
     std::vector<TrackDirection> &entryExitFlags) const {
 
+  // Only test the triangles in the boxes the ray passes through
+  std::vector<size_t> candidates;
+  hierarchy()->getCandidates(start, direction, candidates);
+
   Kernel::V3D vertex1, vertex2, vertex3, intersection;
   TrackDirection entryExit;
-  for (size_t i = 0; getTriangle(i, vertex1, vertex2, vertex3); ++i) {
+  for (const auto i : candidates) {
+    getTriangle(i, vertex1, vertex2, vertex3);
     if (MeshObjectCommon::rayIntersectsTriangle(start, direction, vertex1,
                                                 vertex2, vertex3, intersection,
                                                 entryExit)) {
@@ -192,6 +197,27 @@ void MeshObject::getIntersections(
   // still need to deal with edge cases
 }
 
+/**
+ * Get the hierarchy of boxes over the triangles. It is built by the first
+ * call, which may come from several threads at once. The hierarchy is
+ * returned as a shared pointer so that it stays valid for the caller if the
+ * vertices are moved and a new one is swapped in.
+ * @returns The hierarchy for the current vertices
+ */
+std::shared_ptr<const BoundingVolumeHierarchy> MeshObject::hierarchy() const {
+  auto tree = std::atomic_load(&m_hierarchy);
+  if (!tree) {
+    std::lock_guard<std::mutex> lock(m_hierarchyMutex);
+    tree = std::atomic_load(&m_hierarchy);
+    if (!tree) {
+      tree = std::make_shared<const BoundingVolumeHierarchy>(m_triangles,
+                                                             m_vertices);
+      std::atomic_store(&m_hierarchy, tree);
+    }
+  }
+  return tree;
+}
+
 /*
  * Get a triangle - useful for iterating over triangles
  * @param index :: Index of triangle in MeshObject
@@ -471,12 +497,30 @@ void MeshObject::rotate(const Kernel::Matrix<double> &rotationMatrix) {
   for (Kernel::V3D &vertex : m_vertices) {
     vertex.rotate(rotationMatrix);
   }
+  verticesMoved();
 }
 
 void MeshObject::translate(const Kernel::V3D &translationVector) {
   for (Kernel::V3D &vertex : m_vertices) {
     vertex += translationVector;
   }
+  verticesMoved();
+}
+
+/**
+ * Clear the cached bounding box and rebuild a hierarchy already in use after
+ * the vertices have moved. The new hierarchy is built aside and swapped in,
+ * so callers still holding the old one are not affected. An unused
+ * hierarchy is built when first needed.
+ */
+void MeshObject::verticesMoved() {
+  m_boundingBox = BoundingBox();
+  std::lock_guard<std::mutex> lock(m_hierarchyMutex);
+  if (std::atomic_load(&m_hierarchy)) {
+    auto tree = std::make_shared<const BoundingVolumeHierarchy>(m_triangles,
+                                                                m_vertices);
+    std::atomic_store(&m_hierarchy, std::move(tree));
+  }
 }
 
 /**
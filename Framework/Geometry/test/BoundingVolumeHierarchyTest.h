@@ -0,0 +1,153 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2019 ISIS Rutherford Appleton Laboratory UKRI,
+//     NScD Oak Ridge National Laboratory, European Spallation Source
+//     & Institut Laue - Langevin
+// SPDX - License - Identifier: GPL - 3.0 +
+#ifndef MANTID_GEOMETRY_BOUNDINGVOLUMEHIERARCHYTEST_H_
+#define MANTID_GEOMETRY_BOUNDINGVOLUMEHIERARCHYTEST_H_
+
+#include "MantidGeometry/Objects/BoundingVolumeHierarchy.h"
+#include "MantidGeometry/Objects/MeshObjectCommon.h"
+
+#include <cxxtest/TestSuite.h>
+
+#include <algorithm>
+
+using Mantid::Geometry::BoundingVolumeHierarchy;
+using Mantid::Geometry::TrackDirection;
+using Mantid::Kernel::V3D;
+
+namespace {
+/// A flat square grid of n x n unit squares in the plane z = height, each
+/// made of two triangles
+void addGrid(const size_t n, const double height,
+             std::vector<uint32_t> &triangles, std::vector<V3D> &vertices) {
+  const auto offset = static_cast<uint32_t>(vertices.size());
+  for (size_t i = 0; i <= n; ++i) {
+    for (size_t j = 0; j <= n; ++j) {
+      vertices.emplace_back(static_cast<double>(i), static_cast<double>(j),
+                            height);
+    }
+  }
+  const auto row = static_cast<uint32_t>(n + 1);
+  for (uint32_t i = 0; i < n; ++i) {
+    for (uint32_t j = 0; j < n; ++j) {
+      const uint32_t corner = offset + i * row + j;
+      triangles.insert(triangles.end(), {corner, corner + row, corner + 1});
+      triangles.insert(triangles.end(),
+                       {corner + 1, corner + row, corner + row + 1});
+    }
+  }
+}
+
+/// Indices of the triangles the ray intersects found by testing all of them
+std::vector<size_t> intersectedTriangles(const std::vector<uint32_t> &triangles,
+                                         const std::vector<V3D> &vertices,
+                                         const V3D &start,
+                                         const V3D &direction) {
+  std::vector<size_t> hits;
+  V3D intersection;
+  TrackDirection entryExit;
+  for (size_t i = 0; i < triangles.size() / 3; ++i) {
+    if (Mantid::Geometry::MeshObjectCommon::rayIntersectsTriangle(
+            start, direction, vertices[triangles[3 * i]],
+            vertices[triangles[3 * i + 1]], vertices[triangles[3 * i + 2]],
+            intersection, entryExit))
+      hits.emplace_back(i);
+  }
+  return hits;
+}
+} // namespace
+
+class BoundingVolumeHierarchyTest : public CxxTest::TestSuite {
+public:
+  // This pair of boilerplate methods prevent the suite being created statically
+  // This means the constructor isn't called when running other tests
+  static BoundingVolumeHierarchyTest *createSuite() {
+    return new BoundingVolumeHierarchyTest();
+  }
+  static void destroySuite(BoundingVolumeHierarchyTest *suite) {
+    delete suite;
+  }
+
+  void test_empty_mesh_has_no_candidates() {
+    BoundingVolumeHierarchy hierarchy({}, {});
+    TS_ASSERT_EQUALS(hierarchy.numberOfNodes(), 0);
+    std::vector<size_t> candidates;
+    hierarchy.getCandidates(V3D(0, 0, 0), V3D(1, 0, 0), candidates);
+    TS_ASSERT(candidates.empty());
+  }
+
+  void test_small_mesh_is_a_single_leaf() {
+    std::vector<uint32_t> triangles;
+    std::vector<V3D> vertices;
+    addGrid(1, 0.0, triangles, vertices);
+    BoundingVolumeHierarchy hierarchy(triangles, vertices);
+    TS_ASSERT_EQUALS(hierarchy.numberOfNodes(), 1);
+    std::vector<size_t> candidates;
+    hierarchy.getCandidates(V3D(0.5, 0.5, -1), V3D(0, 0, 1), candidates);
+    std::sort(candidates.begin(), candidates.end());
+    TS_ASSERT_EQUALS(candidates, std::vector<size_t>({0, 1}));
+  }
+
+  void test_ray_only_visits_nearby_triangles() {
+    std::vector<uint32_t> triangles;
+    std::vector<V3D> vertices;
+    addGrid(32, 0.0, triangles, vertices);
+    BoundingVolumeHierarchy hierarchy(triangles, vertices);
+    TS_ASSERT_LESS_THAN(1, hierarchy.numberOfNodes());
+    std::vector<size_t> candidates;
+    hierarchy.getCandidates(V3D(10.3, 20.6, -5), V3D(0, 0, 1), candidates);
+    TS_ASSERT_LESS_THAN_EQUALS(candidates.size(), 8);
+    const auto hits =
+        intersectedTriangles(triangles, vertices, V3D(10.3, 20.6, -5),
+                             V3D(0, 0, 1));
+    TS_ASSERT_EQUALS(hits.size(), 1);
+    TS_ASSERT_DIFFERS(
+        std::find(candidates.begin(), candidates.end(), hits.front()),
+        candidates.end());
+  }
+
+  void test_ray_pointing_away_has_no_candidates() {
+    std::vector<uint32_t> triangles;
+    std::vector<V3D> vertices;
+    addGrid(8, 0.0, triangles, vertices);
+    BoundingVolumeHierarchy hierarchy(triangles, vertices);
+    std::vector<size_t> candidates;
+    hierarchy.getCandidates(V3D(4.5, 4.5, -5), V3D(0, 0, -1), candidates);
+    TS_ASSERT(candidates.empty());
+    hierarchy.getCandidates(V3D(-1, 4.5, 1), V3D(1, 0, 0), candidates);
+    TS_ASSERT(candidates.empty());
+  }
+
+  void test_candidates_include_every_intersected_triangle() {
+    // Two layers so that rays pass through edges and vertices of both
+    std::vector<uint32_t> triangles;
+    std::vector<V3D> vertices;
+    addGrid(16, 0.0, triangles, vertices);
+    addGrid(16, 2.0, triangles, vertices);
+    BoundingVolumeHierarchy hierarchy(triangles, vertices);
+
+    const std::vector<V3D> starts = {V3D(3, 4, -1), V3D(3.5, 7.25, -1),
+                                     V3D(16, 16, 5), V3D(0, 0, 1),
+                                     V3D(-2, -3, -4)};
+    const std::vector<V3D> directions = {
+        V3D(0, 0, 1), V3D(0.6, 0, 0.8), V3D(-0.6, -0.48, -0.64),
+        V3D(0, 0, -1), V3D(1.0 / 3, 2.0 / 3, 2.0 / 3)};
+    for (const auto &start : starts) {
+      for (const auto &direction : directions) {
+        std::vector<size_t> candidates;
+        hierarchy.getCandidates(start, direction, candidates);
+        for (const auto hit :
+             intersectedTriangles(triangles, vertices, start, direction)) {
+          TS_ASSERT_DIFFERS(
+              std::find(candidates.begin(), candidates.end(), hit),
+              candidates.end());
+        }
+      }
+    }
+  }
+};
+
+#endif /* MANTID_GEOMETRY_BOUNDINGVOLUMEHIERARCHYTEST_H_ */
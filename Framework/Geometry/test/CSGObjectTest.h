@@ -580,6 +580,83 @@ public:
     checkTrackIntercept(TL, expectedResults);
   }
 
+  void testDistancesInsideCappedCylinder() {
+    auto cylinder = createCappedCylinder();
+    const std::vector<V3D> starts = {V3D(-10, 0, 0), V3D(0, 0, 0),
+                                     V3D(0, -10, 0), V3D(0, 5, 0)};
+    const std::vector<V3D> directions = {V3D(1, 0, 0), V3D(1, 0, 0),
+                                         V3D(0, 1, 0), V3D(1, 0, 0)};
+    std::vector<double> distances;
+    cylinder->distancesInside(starts, directions, distances);
+    TS_ASSERT_EQUALS(distances.size(), 4);
+    TS_ASSERT_DELTA(distances[0], 4.4, 1e-10);
+    TS_ASSERT_DELTA(distances[1], 1.2, 1e-10);
+    TS_ASSERT_DELTA(distances[2], 6.0, 1e-10);
+    TS_ASSERT_DELTA(distances[3], 0.0, 1e-10);
+  }
+
+  void testDistancesInsideMatchesInterceptSurface() {
+    auto shell = ComponentCreationHelper::createHollowCylinder(
+        0.5, 1.0, 2.0, V3D(0, 0, -1), V3D(0, 0, 1), "shell");
+    std::vector<V3D> starts, directions;
+    for (int i = 0; i < 9; ++i) {
+      const double angle = 0.3 * i;
+      starts.emplace_back(0.1 * i - 0.4, 0.05 * i, -0.2);
+      directions.emplace_back(std::cos(angle), std::sin(angle), 0.0);
+      starts.emplace_back(-3.0, 0.2 * i - 0.8, 0.1 * i - 1.5);
+      directions.emplace_back(Kernel::normalize(V3D(3, 0.1 * i, 1.0)));
+    }
+    std::vector<double> distances;
+    shell->distancesInside(starts, directions, distances);
+    TS_ASSERT_EQUALS(distances.size(), starts.size());
+    for (size_t i = 0; i < starts.size(); ++i) {
+      Track track(starts[i], directions[i]);
+      shell->interceptSurface(track);
+      double expected(0.0);
+      for (const auto &link : track)
+        expected += link.distInsideObject;
+      TS_ASSERT_DELTA(distances[i], expected, 1e-8);
+    }
+  }
+
+  void testDistancesToExitMatchesInterceptSurface() {
+    auto shell = ComponentCreationHelper::createHollowCylinder(
+        0.5, 1.0, 2.0, V3D(0, 0, -1), V3D(0, 0, 1), "shell");
+    std::vector<V3D> starts, directions;
+    for (int i = 0; i < 9; ++i) {
+      const double angle = 0.3 * i;
+      starts.emplace_back(0.7 * std::cos(angle), 0.7 * std::sin(angle), 0.1);
+      directions.emplace_back(-std::cos(angle), -0.1 * i, 0.05 * i);
+      starts.emplace_back(-3.0, 0.2 * i - 0.8, 0.1 * i - 1.5);
+      directions.emplace_back(Kernel::normalize(V3D(3, 0.1 * i, 1.0)));
+    }
+    for (auto &direction : directions)
+      direction.normalize();
+    std::vector<double> distances;
+    shell->distancesToExit(starts, directions, distances);
+    TS_ASSERT_EQUALS(distances.size(), starts.size());
+    for (size_t i = 0; i < starts.size(); ++i) {
+      Track track(starts[i], directions[i]);
+      shell->interceptSurface(track);
+      const double expected =
+          track.count() > 0 ? track.cbegin()->distFromStart : 0.0;
+      TS_ASSERT_DELTA(distances[i], expected, 1e-8);
+    }
+    // Through the wall, across the hole and out through the far wall
+    shell->distancesToExit({V3D(-0.75, 0, 0)}, {V3D(1, 0, 0)}, distances);
+    TS_ASSERT_DELTA(distances[0], 0.25, 1e-10);
+    shell->distancesInside({V3D(-0.75, 0, 0)}, {V3D(1, 0, 0)}, distances);
+    TS_ASSERT_DELTA(distances[0], 0.75, 1e-10);
+  }
+
+  void testDistancesInsideThrowsIfSizesDiffer() {
+    auto cylinder = createCappedCylinder();
+    std::vector<double> distances;
+    TS_ASSERT_THROWS(cylinder->distancesInside({V3D(), V3D()},
+                                               {V3D(1, 0, 0)}, distances),
+                     const std::invalid_argument &);
+  }
+
   void testComplementWithTwoPrimitives() {
     auto shell_ptr = ComponentCreationHelper::createHollowShell(0.5, 1.0);
     auto shell = dynamic_cast<CSGObject *>(shell_ptr.get());
@@ -0,0 +1,255 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2019 ISIS Rutherford Appleton Laboratory UKRI,
+//     NScD Oak Ridge National Laboratory, European Spallation Source
+//     & Institut Laue - Langevin
+// SPDX - License - Identifier: GPL - 3.0 +
+#ifndef MANTID_GEOMETRY_INSTRUMENTCACHETEST_H_
+#define MANTID_GEOMETRY_INSTRUMENTCACHETEST_H_
+
+#include "MantidGeometry/ICompAssembly.h"
+#include "MantidGeometry/IDetector.h"
+#include "MantidGeometry/Instrument.h"
+#include "MantidGeometry/Instrument/InstrumentCache.h"
+#include "MantidGeometry/Instrument/InstrumentDefinitionParser.h"
+#include "MantidGeometry/Instrument/RectangularDetector.h"
+#include "MantidGeometry/Instrument/ReferenceFrame.h"
+#include "MantidGeometry/Instrument/XMLInstrumentParameter.h"
+#include "MantidGeometry/Objects/CSGObject.h"
+#include "MantidKernel/ConfigService.h"
+#include "MantidKernel/MantidVersion.h"
+#include "MantidKernel/Strings.h"
+#include <cxxtest/TestSuite.h>
+
+#include <Poco/File.h>
+#include <Poco/Path.h>
+
+#include <algorithm>
+#include <fstream>
+#include <iterator>
+
+using namespace Mantid::Geometry;
+using namespace Mantid::Kernel;
+
+class InstrumentCacheTest : public CxxTest::TestSuite {
+public:
+  // This pair of boilerplate methods prevent the suite being created statically
+  // This means the constructor isn't called when running other tests
+  static InstrumentCacheTest *createSuite() {
+    return new InstrumentCacheTest();
+  }
+  static void destroySuite(InstrumentCacheTest *suite) { delete suite; }
+
+  void test_cache_is_disabled_without_directory() {
+    ConfigService::Instance().setString("instrumentDefinition.cache.directory",
+                                        "");
+    InstrumentCache cache("TESTINSTRUMENT1234");
+    TS_ASSERT(!cache.enabled());
+    TS_ASSERT(!cache.load());
+  }
+
+  void test_round_trip_keeps_tree_and_parameters() {
+    auto original = parse("IDF_for_UNIT_TESTING2.xml");
+    auto cached = roundTrip(*original);
+    TS_ASSERT(cached);
+    if (!cached)
+      return;
+
+    TS_ASSERT_EQUALS(cached->getName(), original->getName());
+    TS_ASSERT_EQUALS(cached->getFilename(), original->getFilename());
+    TS_ASSERT_EQUALS(cached->getXmlText(), original->getXmlText());
+    TS_ASSERT_EQUALS(cached->getValidFromDate(), original->getValidFromDate());
+    TS_ASSERT_EQUALS(cached->getDefaultView(), original->getDefaultView());
+    TS_ASSERT_EQUALS(cached->getReferenceFrame()->pointingUp(),
+                     original->getReferenceFrame()->pointingUp());
+    TS_ASSERT_EQUALS(cached->getReferenceFrame()->pointingAlongBeam(),
+                     original->getReferenceFrame()->pointingAlongBeam());
+    assertSameTree(*cached, *original);
+    assertSameDetectors(*cached, *original);
+    TS_ASSERT_EQUALS(cached->getSource()->getName(),
+                     original->getSource()->getName());
+    TS_ASSERT_EQUALS(cached->getSample()->getName(),
+                     original->getSample()->getName());
+
+    const auto &cachedParams = cached->getLogfileCache();
+    const auto &originalParams = original->getLogfileCache();
+    TS_ASSERT(!originalParams.empty());
+    TS_ASSERT_EQUALS(cachedParams.size(), originalParams.size());
+    auto cachedParam = cachedParams.cbegin();
+    auto originalParam = originalParams.cbegin();
+    for (; cachedParam != cachedParams.cend() &&
+           originalParam != originalParams.cend();
+         ++cachedParam, ++originalParam) {
+      TS_ASSERT_EQUALS(cachedParam->first.first, originalParam->first.first);
+      TS_ASSERT_EQUALS(cachedParam->first.second->getFullName(),
+                       originalParam->first.second->getFullName());
+      TS_ASSERT_EQUALS(cachedParam->second->m_value,
+                       originalParam->second->m_value);
+      TS_ASSERT_EQUALS(cachedParam->second->m_type,
+                       originalParam->second->m_type);
+      TS_ASSERT_EQUALS(cachedParam->second->m_formula,
+                       originalParam->second->m_formula);
+      TS_ASSERT_EQUALS(cachedParam->second->m_constraint,
+                       originalParam->second->m_constraint);
+      TS_ASSERT_EQUALS(cachedParam->second->m_penaltyFactor,
+                       originalParam->second->m_penaltyFactor);
+    }
+  }
+
+  void test_round_trip_of_rectangular_detectors() {
+    auto original = parse("IDF_for_RECTANGULAR_UNIT_TESTING.xml");
+    auto cached = roundTrip(*original);
+    TS_ASSERT(cached);
+    if (!cached)
+      return;
+
+    assertSameTree(*cached, *original);
+    assertSameDetectors(*cached, *original);
+    auto bank = boost::dynamic_pointer_cast<const RectangularDetector>(
+        cached->getComponentByName("bank1"));
+    TS_ASSERT(bank);
+    if (bank) {
+      const auto originalBank =
+          boost::dynamic_pointer_cast<const RectangularDetector>(
+              original->getComponentByName("bank1"));
+      TS_ASSERT_EQUALS(bank->xpixels(), originalBank->xpixels());
+      TS_ASSERT_EQUALS(bank->ypixels(), originalBank->ypixels());
+      TS_ASSERT_EQUALS(bank->getDetectorIDAtXY(2, 3),
+                       originalBank->getDetectorIDAtXY(2, 3));
+    }
+  }
+
+  void test_save_and_load_through_cache_directory() {
+    const auto directory =
+        Poco::Path(ConfigService::Instance().getTempDir())
+            .append("InstrumentCacheTest")
+            .toString();
+    ConfigService::Instance().setString("instrumentDefinition.cache.directory",
+                                        directory);
+    auto original = parse("IDF_for_UNIT_TESTING2.xml");
+    InstrumentCache cache("TESTINSTRUMENT1234");
+    TS_ASSERT(cache.enabled());
+    TS_ASSERT(!cache.load());
+    cache.save(*original);
+    auto cached = cache.load();
+    TS_ASSERT(cached);
+    if (cached)
+      assertSameDetectors(*cached, *original);
+
+    ConfigService::Instance().setString("instrumentDefinition.cache.directory",
+                                        "");
+    Poco::File(directory).remove(true);
+  }
+
+  void test_loading_invalid_file_throws() {
+    const auto filename =
+        Poco::Path(ConfigService::Instance().getTempDir())
+            .append("InstrumentCacheTest_invalid.instrument")
+            .toString();
+    {
+      std::ofstream out(filename, std::ios::binary);
+      out << "not an instrument";
+    }
+    TS_ASSERT_THROWS(InstrumentCache::loadFile(filename),
+                     const std::runtime_error &);
+    Poco::File(filename).remove();
+  }
+
+  void test_file_written_by_another_version_is_rejected() {
+    const auto filename =
+        Poco::Path(ConfigService::Instance().getTempDir())
+            .append("InstrumentCacheTest_version.instrument")
+            .toString();
+    auto original = parse("IDF_for_UNIT_TESTING2.xml");
+    InstrumentCache::saveFile(*original, filename);
+    TS_ASSERT_THROWS_NOTHING(InstrumentCache::loadFile(filename));
+
+    // Change the revision recorded in the file
+    std::string content;
+    {
+      std::ifstream in(filename, std::ios::binary);
+      content.assign(std::istreambuf_iterator<char>(in),
+                     std::istreambuf_iterator<char>());
+    }
+    const auto position = content.find(MantidVersion::revisionFull());
+    TS_ASSERT_DIFFERS(position, std::string::npos);
+    if (position != std::string::npos) {
+      content[position] = content[position] == '0' ? '1' : '0';
+      std::ofstream out(filename, std::ios::binary);
+      out << content;
+    }
+    TS_ASSERT_THROWS(InstrumentCache::loadFile(filename),
+                     const std::runtime_error &);
+    Poco::File(filename).remove();
+  }
+
+private:
+  Instrument_sptr parse(const std::string &name) {
+    const auto filename = ConfigService::Instance().getInstrumentDirectory() +
+                          "/unit_testing/" + name;
+    InstrumentDefinitionParser parser(filename, "For Unit Testing",
+                                      Strings::loadFile(filename));
+    auto instrument = parser.parseXML(nullptr);
+    // Clean up the geometry cache file written by the parser
+    const auto vtpFilename = parser.createVTPFileName();
+    if (!vtpFilename.empty() && Poco::File(vtpFilename).exists())
+      Poco::File(vtpFilename).remove();
+    return instrument;
+  }
+
+  Instrument_sptr roundTrip(const Instrument &instrument) {
+    const auto filename =
+        Poco::Path(ConfigService::Instance().getTempDir())
+            .append("InstrumentCacheTest.instrument")
+            .toString();
+    Instrument_sptr cached;
+    TS_ASSERT_THROWS_NOTHING(InstrumentCache::saveFile(instrument, filename));
+    TS_ASSERT_THROWS_NOTHING(cached = InstrumentCache::loadFile(filename));
+    if (Poco::File(filename).exists())
+      Poco::File(filename).remove();
+    return cached;
+  }
+
+  void assertSameTree(const IComponent &cached, const IComponent &original) {
+    TS_ASSERT_EQUALS(cached.type(), original.type());
+    TS_ASSERT_EQUALS(cached.getName(), original.getName());
+    TS_ASSERT_EQUALS(cached.getRelativePos(), original.getRelativePos());
+    TS_ASSERT_EQUALS(cached.getRelativeRot(), original.getRelativeRot());
+    const auto cachedAssembly = dynamic_cast<const ICompAssembly *>(&cached);
+    const auto originalAssembly =
+        dynamic_cast<const ICompAssembly *>(&original);
+    TS_ASSERT_EQUALS(cachedAssembly == nullptr, originalAssembly == nullptr);
+    if (!cachedAssembly || !originalAssembly)
+      return;
+    TS_ASSERT_EQUALS(cachedAssembly->nelements(),
+                     originalAssembly->nelements());
+    const auto size =
+        std::min(cachedAssembly->nelements(), originalAssembly->nelements());
+    for (int i = 0; i < size; ++i)
+      assertSameTree(*cachedAssembly->getChild(i),
+                     *originalAssembly->getChild(i));
+  }
+
+  void assertSameDetectors(const Instrument &cached,
+                           const Instrument &original) {
+    TS_ASSERT_EQUALS(cached.getDetectorIDs(false),
+                     original.getDetectorIDs(false));
+    TS_ASSERT_EQUALS(cached.getMonitors(), original.getMonitors());
+    for (const auto id : original.getDetectorIDs(false)) {
+      const auto originalDet = original.getDetector(id);
+      const auto cachedDet = cached.getDetector(id);
+      TS_ASSERT_EQUALS(cachedDet->getPos(), originalDet->getPos());
+      TS_ASSERT_EQUALS(cachedDet->getRotation(), originalDet->getRotation());
+      const auto originalShape =
+          boost::dynamic_pointer_cast<const CSGObject>(originalDet->shape());
+      const auto cachedShape =
+          boost::dynamic_pointer_cast<const CSGObject>(cachedDet->shape());
+      TS_ASSERT_EQUALS(originalShape == nullptr, cachedShape == nullptr);
+      if (originalShape && cachedShape)
+        TS_ASSERT_EQUALS(cachedShape->getShapeXML(),
+                         originalShape->getShapeXML());
+    }
+  }
+};
+
+#endif /* MANTID_GEOMETRY_INSTRUMENTCACHETEST_H_ */
@@ -964,6 +964,27 @@ public:
     auto moved = octahedron->getVertices();
     TS_ASSERT_DELTA(moved, checkVector, 1e-8);
   }
+
+  void testIsValidAfterTranslation() {
+    auto cube = createCube(4.0);
+    // Tests the triangles before the move
+    TS_ASSERT(cube->isValid(V3D(1, 1, 1)));
+    TS_ASSERT(!cube->isValid(V3D(11, 1, 1)));
+    cube->translate(V3D(10, 0, 0));
+    TS_ASSERT(!cube->isValid(V3D(1, 1, 1)));
+    TS_ASSERT(cube->isValid(V3D(11, 1, 1)));
+  }
+
+  void testInterceptAfterTranslation() {
+    auto cube = createCube(4.0);
+    Track before(V3D(-10, 1, 1), V3D(1, 0, 0));
+    TS_ASSERT_EQUALS(cube->interceptSurface(before), 1);
+    cube->translate(V3D(0, 10, 0));
+    Track missed(V3D(-10, 1, 1), V3D(1, 0, 0));
+    TS_ASSERT_EQUALS(cube->interceptSurface(missed), 0);
+    Track hit(V3D(-10, 11, 1), V3D(1, 0, 0));
+    TS_ASSERT_EQUALS(cube->interceptSurface(hit), 1);
+  }
 };
 
 // -----------------------------------------------------------------------------
@@ -9,6 +9,7 @@
 
 #include "MantidBeamline/ComponentInfo.h"
 #include "MantidBeamline/DetectorInfo.h"
+#include "MantidGeometry/Instrument/ComponentInfo.h"
 #include "MantidGeometry/Instrument/Detector.h"
 #include "MantidGeometry/Instrument/Parameter.h"
 #include "MantidGeometry/Instrument/ParameterFactory.h"
@@ -20,6 +21,8 @@
 #include <boost/function.hpp>
 #include <boost/make_shared.hpp>
 
+#include <algorithm>
+
 using Mantid::Geometry::IComponent;
 using Mantid::Geometry::IComponent_sptr;
 using Mantid::Geometry::Instrument_sptr;
@@ -473,6 +476,42 @@ public:
     TS_ASSERT_EQUALS(fetched->value<int>(), value2);
   }
 
+  void test_getRecursiveForAllComponents_matches_getRecursive() {
+    ParameterMap pmap;
+    pmap.setInstrument(m_testInstrument.get());
+    const std::string name("eff");
+    pmap.addDouble(m_testInstrument.get(), name, 1.0);
+    const auto bank = m_testInstrument->getComponentByName("bank1");
+    pmap.addDouble(bank.get(), name, 2.0);
+    const auto detector = m_testInstrument->getDetector(1);
+    pmap.addDouble(detector->getComponentID(), name, 3.0);
+    pmap.addInt(detector->getComponentID(), "other", 4);
+
+    const auto &componentInfo = pmap.componentInfo();
+    const auto params = pmap.getRecursiveForAllComponents(name);
+    TS_ASSERT_EQUALS(params.size(), componentInfo.size());
+    for (size_t i = 0; i < params.size(); ++i)
+      TS_ASSERT_EQUALS(params[i],
+                       pmap.getRecursive(componentInfo.componentID(i), name));
+    const auto detIndex = m_testInstrument->detectorIndex(1);
+    TS_ASSERT_EQUALS(params[detIndex]->value<double>(), 3.0);
+    TS_ASSERT_EQUALS(params[detIndex + 1]->value<double>(), 2.0);
+    TS_ASSERT_EQUALS(params[componentInfo.root()]->value<double>(), 1.0);
+
+    const auto typed =
+        pmap.getRecursiveForAllComponents(name, ParameterMap::pInt());
+    TS_ASSERT(std::none_of(
+        typed.cbegin(), typed.cend(),
+        [](const Parameter_sptr &param) { return param != nullptr; }));
+  }
+
+  void test_getRecursiveForAllComponents_throws_without_instrument() {
+    ParameterMap pmap;
+    pmap.addDouble(m_testInstrument.get(), "eff", 1.0);
+    TS_ASSERT_THROWS(pmap.getRecursiveForAllComponents("eff"),
+                     const std::runtime_error &);
+  }
+
   void testClearByName_Only_Removes_Named_Parameter() {
     ParameterMap pmap;
     pmap.addDouble(m_testInstrument.get(), "first", 5.4);
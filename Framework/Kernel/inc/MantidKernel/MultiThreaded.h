@@ -8,6 +8,7 @@
 #define MANTID_KERNEL_MULTITHREADED_H_
 
 #include "MantidKernel/DataItem.h"
+#include "MantidKernel/DllConfig.h"
 
 #include <atomic>
 #include <mutex>
@@ -80,6 +81,26 @@ void AtomicOp(std::atomic<T> &f, T d, BinaryOp op) {
   } while (!f.compare_exchange_weak(old, desired));
 }
 
+/// The number of threads a parallel region started by this thread may use
+MANTID_KERNEL_DLL int threadBudget();
+
+/** Marks the current thread as one of several workers running concurrently,
+ * e.g. a ThreadPool thread, for the lifetime of the object. While workers are
+ * registered the cores are shared between them by threadBudget() so that
+ * parallel loops called from the workers do not oversubscribe the machine.
+ */
+class MANTID_KERNEL_DLL ConcurrentWorkerScope {
+public:
+  ConcurrentWorkerScope();
+  ~ConcurrentWorkerScope();
+  ConcurrentWorkerScope(const ConcurrentWorkerScope &) = delete;
+  ConcurrentWorkerScope &operator=(const ConcurrentWorkerScope &) = delete;
+
+private:
+  /// True if this object registered the thread, false if it was nested
+  bool m_registered;
+};
+
 } // namespace Kernel
 } // namespace Mantid
 
@@ -137,14 +158,15 @@ void AtomicOp(std::atomic<T> &f, T d, BinaryOp op) {
  *   code to be executed in parallel
  */
 #define PARALLEL_FOR_IF(condition)                                             \
-    PRAGMA(omp parallel for if (condition) )
+    PRAGMA(omp parallel for if (condition)                                     \
+           num_threads(Mantid::Kernel::threadBudget()) )
 
 /** Includes code to add OpenMP commands to run the next for loop in parallel.
  *   This includes no checks to see if workspaces are suitable
  *   and therefore should not be used in any loops that access workspaces.
  */
 #define PARALLEL_FOR_NO_WSP_CHECK()                                            \
-    PRAGMA(omp parallel for)
+    PRAGMA(omp parallel for num_threads(Mantid::Kernel::threadBudget()) )
 
 /** Includes code to add OpenMP commands to run the next for loop in parallel.
  *  and declare the variables to be firstprivate.
@@ -152,10 +174,12 @@ void AtomicOp(std::atomic<T> &f, T d, BinaryOp op) {
  *  and therefore should not be used in any loops that access workspace.
  */
 #define PARALLEL_FOR_NOWS_CHECK_FIRSTPRIVATE(variable)                         \
-  PRAGMA(omp parallel for firstprivate(variable) )
+  PRAGMA(omp parallel for firstprivate(variable)                               \
+         num_threads(Mantid::Kernel::threadBudget()) )
 
 #define PARALLEL_FOR_NO_WSP_CHECK_FIRSTPRIVATE2(variable1, variable2)          \
-  PRAGMA(omp parallel for firstprivate(variable1, variable2) )
+  PRAGMA(omp parallel for firstprivate(variable1, variable2)                   \
+         num_threads(Mantid::Kernel::threadBudget()) )
 
 /** Ensures that the next execution line or block is only executed if
  * there are multple threads execting in this region
@@ -192,7 +216,8 @@ void AtomicOp(std::atomic<T> &f, T d, BinaryOp op) {
 
 #define PARALLEL_THREAD_NUMBER omp_get_thread_num()
 
-#define PARALLEL PRAGMA(omp parallel)
+#define PARALLEL                                                               \
+  PRAGMA(omp parallel num_threads(Mantid::Kernel::threadBudget()))
 
 #define PARALLEL_SECTIONS PRAGMA(omp sections nowait)
 
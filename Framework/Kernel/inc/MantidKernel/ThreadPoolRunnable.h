@@ -25,7 +25,8 @@ class ThreadScheduler;
 class MANTID_KERNEL_DLL ThreadPoolRunnable : public Poco::Runnable {
 public:
   ThreadPoolRunnable(size_t threadnum, ThreadScheduler *scheduler,
-                     ProgressBase *prog = nullptr, double waitSec = 0.0);
+                     ProgressBase *prog = nullptr, double waitSec = 0.0,
+                     bool pinThread = false);
 
   /// Return the thread number of this thread.
   size_t threadnum() { return m_threadnum; }
@@ -46,6 +47,9 @@ private:
 
   /// How many seconds you are allowed to wait with no tasks before exiting.
   double m_waitSec;
+
+  /// Whether the thread is pinned to a core while it runs
+  bool m_pinThread;
 };
 
 } // namespace Kernel
@@ -10,6 +10,7 @@
 #include "MantidKernel/DllConfig.h"
 #include "MantidKernel/SingletonHolder.h"
 #include "MantidKernel/Task.h"
+#include <atomic>
 #include <deque>
 #include <map>
 #include <vector>
@@ -104,9 +105,9 @@ public:
 
 protected:
   /// Total cost of all tasks
-  double m_cost;
+  std::atomic<double> m_cost;
   /// Accumulated cost of tasks that have been executed (popped)
-  double m_costExecuted;
+  std::atomic<double> m_costExecuted;
   /// Mutex to prevent simultaneous access to the queue.
   std::mutex m_queueLock;
   /// The exception that aborted the run.
@@ -142,7 +143,7 @@ public:
   void push(std::shared_ptr<Task> newTask) override {
     // Cache the total cost
     m_queueLock.lock();
-    m_cost += newTask->cost();
+    m_cost = m_cost + newTask->cost();
     m_queue.push_back(newTask);
     m_queueLock.unlock();
   }
@@ -244,7 +245,7 @@ public:
   void push(std::shared_ptr<Task> newTask) override {
     // Cache the total cost
     m_queueLock.lock();
-    m_cost += newTask->cost();
+    m_cost = m_cost + newTask->cost();
     m_map.emplace(newTask->cost(), newTask);
     m_queueLock.unlock();
   }
@@ -44,7 +44,7 @@ public:
   void push(std::shared_ptr<Task> newTask) override {
     // Cache the total cost
     std::lock_guard<std::mutex> lock(m_queueLock);
-    m_cost += newTask->cost();
+    m_cost = m_cost + newTask->cost();
 
     boost::shared_ptr<std::mutex> mut = newTask->getMutex();
     m_supermap[mut].emplace(newTask->cost(), newTask);
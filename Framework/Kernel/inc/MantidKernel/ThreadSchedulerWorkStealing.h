@@ -0,0 +1,77 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2019 ISIS Rutherford Appleton Laboratory UKRI,
+//     NScD Oak Ridge National Laboratory, European Spallation Source
+//     & Institut Laue - Langevin
+// SPDX - License - Identifier: GPL - 3.0 +
+#ifndef MANTID_KERNEL_THREADSCHEDULERWORKSTEALING_H_
+#define MANTID_KERNEL_THREADSCHEDULERWORKSTEALING_H_
+
+#include "MantidKernel/DllConfig.h"
+#include "MantidKernel/ThreadScheduler.h"
+
+#include <atomic>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <vector>
+
+namespace Mantid {
+namespace Kernel {
+
+/** ThreadSchedulerWorkStealing : A ThreadScheduler which keeps one queue of
+ * tasks per thread, each with its own lock, so that threads popping tasks do
+ * not contend for a single queue.
+ *
+ * Tasks are pushed to the queues in turn. A thread runs the tasks of its own
+ * queue in the order they were pushed and, once it is empty, steals from the
+ * other end of the queue with the largest remaining cost. As in
+ * ThreadSchedulerMutexes, tasks whose mutex is held by a running task are
+ * passed over while there are others to run.
+ *
+ * This scheduler is suited to a large number of short tasks, where the single
+ * lock of the other schedulers limits how many threads can be kept busy.
+ */
+class MANTID_KERNEL_DLL ThreadSchedulerWorkStealing : public ThreadScheduler {
+public:
+  explicit ThreadSchedulerWorkStealing(size_t numQueues = 0);
+  ~ThreadSchedulerWorkStealing() override;
+
+  void push(std::shared_ptr<Task> newTask) override;
+  std::shared_ptr<Task> pop(size_t threadnum) override;
+  void finished(Task *task, size_t threadnum) override;
+  size_t size() override;
+  bool empty() override;
+  void clear() override;
+
+private:
+  /// The tasks of one thread
+  struct WorkerQueue {
+    /// Protects the tasks
+    std::mutex lock;
+    /// The tasks, in the order they were pushed
+    std::deque<std::shared_ptr<Task>> tasks;
+    /// The total cost of the tasks
+    std::atomic<double> cost{0.0};
+  };
+
+  std::shared_ptr<Task> popFrom(WorkerQueue &queue, const bool fromFront,
+                                const bool skipBusy);
+
+  /// One queue per thread
+  std::vector<std::unique_ptr<WorkerQueue>> m_queues;
+  /// The queue the next task is pushed to
+  std::atomic<size_t> m_nextQueue{0};
+  /// The number of tasks in all queues
+  std::atomic<size_t> m_size{0};
+  /// Protects the set of busy mutexes
+  std::mutex m_busyLock;
+  /// Mutexes of the tasks currently running
+  std::set<boost::shared_ptr<std::mutex>> m_busyMutexes;
+};
+
+} // namespace Kernel
+} // namespace Mantid
+
+#endif /* MANTID_KERNEL_THREADSCHEDULERWORKSTEALING_H_ */
@@ -6,6 +6,7 @@
 // SPDX - License - Identifier: GPL - 3.0 +
 #include "MantidKernel/DiskBuffer.h"
 #include "MantidKernel/ISaveable.h"
+#include <algorithm>
 #include <sstream>
 #include <utility>
 
@@ -60,18 +61,22 @@ void DiskBuffer::toWrite(ISaveable *item) {
     // add new size
     size_t newMemorySize = item->getDataMemorySize();
     m_writeBufferUsed += newMemorySize;
+    const bool bufferFull = m_writeBufferUsed > m_writeBufferSize;
     uniqueLock.unlock();
     item->setBufferSize(newMemorySize);
+    if (bufferFull)
+      writeOldObjects();
   } else {
-    std::lock_guard<std::mutex> lock(m_mutex);
+    std::unique_lock<std::mutex> uniqueLock(m_mutex);
     m_toWriteBuffer.push_front(item);
     m_writeBufferUsed += item->setBufferPosition(m_toWriteBuffer.begin());
     m_nObjectsToWrite++;
+    // Should we now write out the old data?
+    const bool bufferFull = m_writeBufferUsed > m_writeBufferSize;
+    uniqueLock.unlock();
+    if (bufferFull)
+      writeOldObjects();
   }
-
-  // Should we now write out the old data?
-  if (m_writeBufferUsed > m_writeBufferSize)
-    writeOldObjects();
 }
 
 //---------------------------------------------------------------------------------------------
@@ -116,53 +121,14 @@ void DiskBuffer::writeOldObjects() {
   size_t objectsNotWritten(0);
   size_t memoryNotWritten(0);
 
-  // Iterate through the list
-  auto it = m_toWriteBuffer.begin();
-  auto it_end = m_toWriteBuffer.end();
-
-  ISaveable *obj = nullptr;
-
-  for (; it != it_end; ++it) {
-    obj = *it;
+  // Split the buffer into the objects that can be written now and the busy
+  // ones, which have to stay in the buffer.
+  std::vector<ISaveable *> toSave;
+  toSave.reserve(m_nObjectsToWrite);
+  for (auto obj : m_toWriteBuffer) {
     if (!obj->isBusy()) {
-      uint64_t NumObjEvents = obj->getTotalDataSize();
-      uint64_t fileIndexStart;
-      if (!obj->wasSaved()) {
-        fileIndexStart = this->allocate(NumObjEvents);
-        // Write to the disk; this will call the object specific save function;
-        // Prevent simultaneous file access (e.g. write while loading)
-        obj->saveAt(fileIndexStart, NumObjEvents);
-      } else {
-        uint64_t NumFileEvents = obj->getFileSize();
-        if (NumObjEvents != NumFileEvents) {
-          // Event list changed size. The MRU can tell us where it best fits
-          // now.
-          fileIndexStart = this->relocate(obj->getFilePosition(), NumFileEvents,
-                                          NumObjEvents);
-          // Write to the disk; this will call the object specific save
-          // function;
-          obj->saveAt(fileIndexStart, NumObjEvents);
-        } else // despite object size have not been changed, it can be modified
-               // other way. In this case, the method which changed the data
-               // should set dataChanged ID
-        {
-          if (obj->isDataChanged()) {
-            fileIndexStart = obj->getFilePosition();
-            // Write to the disk; this will call the object specific save
-            // function;
-            obj->saveAt(fileIndexStart, NumObjEvents);
-            // this is questionable operation, which adjust file size in case
-            // when the file postions were allocated externaly
-            if (fileIndexStart + NumObjEvents > m_fileLength)
-              m_fileLength = fileIndexStart + NumObjEvents;
-          } else // just clean the object up -- it just occupies memory
-            obj->clearDataFromMemory();
-        }
-      }
-      // tell the object that it has been removed from the buffer
-      obj->clearBufferState();
-    } else // object busy
-    {
+      toSave.push_back(obj);
+    } else {
       // The object is busy, can't write. Save it for later
       couldNotWrite.push_back(obj);
       // When a prefix or postfix operator is applied to a function argument,
@@ -174,13 +140,64 @@ void DiskBuffer::writeOldObjects() {
     }
   }
 
+  // Visit the objects which already have a place on file in the order of
+  // their file position, so the writes (and the reloads done by saveAt) sweep
+  // through the file rather than seeking back and forth. New objects keep the
+  // buffer order and are allocated after them.
+  auto firstNew = std::stable_partition(
+      toSave.begin(), toSave.end(),
+      [](const ISaveable *obj) { return obj->wasSaved(); });
+  std::stable_sort(toSave.begin(), firstNew,
+                   [](const ISaveable *a, const ISaveable *b) {
+                     return a->getFilePosition() < b->getFilePosition();
+                   });
+
+  for (auto obj : toSave) {
+    uint64_t NumObjEvents = obj->getTotalDataSize();
+    uint64_t fileIndexStart;
+    if (!obj->wasSaved()) {
+      fileIndexStart = this->allocate(NumObjEvents);
+      // Write to the disk; this will call the object specific save function;
+      // Prevent simultaneous file access (e.g. write while loading)
+      obj->saveAt(fileIndexStart, NumObjEvents);
+    } else {
+      uint64_t NumFileEvents = obj->getFileSize();
+      if (NumObjEvents != NumFileEvents) {
+        // Event list changed size. The MRU can tell us where it best fits
+        // now.
+        fileIndexStart = this->relocate(obj->getFilePosition(), NumFileEvents,
+                                        NumObjEvents);
+        // Write to the disk; this will call the object specific save
+        // function;
+        obj->saveAt(fileIndexStart, NumObjEvents);
+      } else // despite object size have not been changed, it can be modified
+             // other way. In this case, the method which changed the data
+             // should set dataChanged ID
+      {
+        if (obj->isDataChanged()) {
+          fileIndexStart = obj->getFilePosition();
+          // Write to the disk; this will call the object specific save
+          // function;
+          obj->saveAt(fileIndexStart, NumObjEvents);
+          // this is questionable operation, which adjust file size in case
+          // when the file postions were allocated externaly
+          if (fileIndexStart + NumObjEvents > m_fileLength)
+            m_fileLength = fileIndexStart + NumObjEvents;
+        } else // just clean the object up -- it just occupies memory
+          obj->clearDataFromMemory();
+      }
+    }
+    // tell the object that it has been removed from the buffer
+    obj->clearBufferState();
+  }
+
   // use last object to clear NeXus buffer and actually write data to HDD
-  if (obj) {
+  if (!m_toWriteBuffer.empty()) {
     // NXS needs to flush the writes to file by closing and re-opening the data
     // block.
-    // For speed, it is best to do this only once per write dump, using last
-    // object saved
-    obj->flushData();
+    // For speed, it is best to do this only once per write dump, using the
+    // last object in the buffer, whether it was saved or is busy
+    m_toWriteBuffer.back()->flushData();
   }
 
   // Exchange with the new map you built out of the not-written blocks.
@@ -0,0 +1,66 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2019 ISIS Rutherford Appleton Laboratory UKRI,
+//     NScD Oak Ridge National Laboratory, European Spallation Source
+//     & Institut Laue - Langevin
+// SPDX - License - Identifier: GPL - 3.0 +
+#include "MantidKernel/MultiThreaded.h"
+
+#include <algorithm>
+
+namespace Mantid {
+namespace Kernel {
+
+namespace {
+/// The number of threads currently registered as concurrent workers
+std::atomic<int> g_concurrentWorkers{0};
+/// Whether the current thread is registered as a concurrent worker
+thread_local bool g_isConcurrentWorker = false;
+} // namespace
+
+/** The number of threads a parallel region started by the calling thread may
+ * use without oversubscribing the cores.
+ *  - Inside an active OpenMP parallel region this is 1, so that nested loops
+ *    run serially in the thread that reached them.
+ *  - In a thread registered with a ConcurrentWorkerScope, the maximum number
+ *    of threads is shared evenly between the registered workers.
+ *  - Otherwise it is the maximum number of OpenMP threads.
+ * @return the number of threads to use, at least 1
+ */
+int threadBudget() {
+#ifdef _OPENMP
+  if (omp_in_parallel())
+    return 1;
+  const int maxThreads = omp_get_max_threads();
+  if (g_isConcurrentWorker) {
+    const int workers = g_concurrentWorkers.load(std::memory_order_relaxed);
+    if (workers > 1)
+      return std::max(1, maxThreads / workers);
+  }
+  return maxThreads;
+#else
+  return 1;
+#endif
+}
+
+/** Register the calling thread as a concurrent worker. Nested scopes in the
+ * same thread are only counted once.
+ */
+ConcurrentWorkerScope::ConcurrentWorkerScope()
+    : m_registered(!g_isConcurrentWorker) {
+  if (m_registered) {
+    g_isConcurrentWorker = true;
+    ++g_concurrentWorkers;
+  }
+}
+
+/// Remove the calling thread from the concurrent workers
+ConcurrentWorkerScope::~ConcurrentWorkerScope() {
+  if (m_registered) {
+    --g_concurrentWorkers;
+    g_isConcurrentWorker = false;
+  }
+}
+
+} // namespace Kernel
+} // namespace Mantid
@@ -98,6 +98,10 @@ size_t ThreadPool::getNumPhysicalCores() {
 void ThreadPool::start(double waitSec) {
   if (m_started)
     throw std::runtime_error("Threads have already started.");
+  // Pinning the threads to cores keeps them next to the memory they touch
+  const bool pinThreads = Kernel::ConfigService::Instance()
+                              .getValue<bool>("MultiThreaded.PinThreads")
+                              .get_value_or(false);
   // Now, launch that many threads and let them wait for new tasks.
   m_threads.clear();
   m_runnables.clear();
@@ -108,8 +112,8 @@ void ThreadPool::start(double waitSec) {
     // Create the thread
     auto thread = std::make_unique<Poco::Thread>(name.str());
     // Make the runnable object and run it
-    auto runnable = std::make_unique<ThreadPoolRunnable>(i, m_scheduler.get(),
-                                                         m_prog.get(), waitSec);
+    auto runnable = std::make_unique<ThreadPoolRunnable>(
+        i, m_scheduler.get(), m_prog.get(), waitSec, pinThreads);
     thread->start(*runnable);
     m_threads.push_back(std::move(thread));
     m_runnables.push_back(std::move(runnable));
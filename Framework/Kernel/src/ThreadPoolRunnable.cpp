@@ -5,15 +5,70 @@
 //     & Institut Laue - Langevin
 // SPDX - License - Identifier: GPL - 3.0 +
 #include "MantidKernel/ThreadPoolRunnable.h"
+#include "MantidKernel/Logger.h"
+#include "MantidKernel/MultiThreaded.h"
 #include "MantidKernel/ProgressBase.h"
 #include "MantidKernel/Task.h"
 #include "MantidKernel/ThreadScheduler.h"
 
 #include <Poco/Thread.h>
 
+#ifdef __linux__
+#include <cerrno>
+#include <cstring>
+#include <pthread.h>
+#include <sched.h>
+#include <unistd.h>
+#endif
+
 namespace Mantid {
 namespace Kernel {
 
+namespace {
+/// static logger
+Logger g_log("ThreadPoolRunnable");
+
+/** Pin the calling thread to a core, so that it keeps using the caches and
+ * the NUMA memory node it first touched data on. The threads are spread over
+ * the cores the process is allowed to run on, which may be fewer than those
+ * of the machine. Only implemented on Linux.
+ * @param threadnum :: the number of the thread in the pool
+ */
+void pinToCore(const size_t threadnum) {
+#ifdef __linux__
+  cpu_set_t allowed;
+  CPU_ZERO(&allowed);
+  if (sched_getaffinity(getpid(), sizeof(cpu_set_t), &allowed) != 0) {
+    g_log.warning() << "Thread " << threadnum
+                    << " is not pinned, the cores of the process are unknown: "
+                    << std::strerror(errno) << "\n";
+    return;
+  }
+  const auto numCores = static_cast<size_t>(CPU_COUNT(&allowed));
+  if (numCores == 0)
+    return;
+  // Take the n-th allowed core
+  auto remaining = threadnum % numCores;
+  int core = 0;
+  for (; core < CPU_SETSIZE; ++core) {
+    if (CPU_ISSET(core, &allowed) && remaining-- == 0)
+      break;
+  }
+  cpu_set_t cpuSet;
+  CPU_ZERO(&cpuSet);
+  CPU_SET(core, &cpuSet);
+  const int error =
+      pthread_setaffinity_np(pthread_self(), sizeof(cpu_set_t), &cpuSet);
+  if (error != 0) {
+    g_log.warning() << "Could not pin thread " << threadnum << " to core "
+                    << core << ": " << std::strerror(error) << "\n";
+  }
+#else
+  UNUSED_ARG(threadnum)
+#endif
+}
+} // namespace
+
 //-----------------------------------------------------------------------------------
 /** Constructor
  *
@@ -24,12 +79,15 @@ namespace Kernel {
  *        automatic progress reporting will be handled by the thread pool.
  * @param waitSec :: how many seconds the thread is allowed to wait with no
  *tasks.
+ * @param pinThread :: pin the thread running this runnable to one of the cores
+ *        available to the process, chosen by the thread number
  */
 ThreadPoolRunnable::ThreadPoolRunnable(size_t threadnum,
                                        ThreadScheduler *scheduler,
-                                       ProgressBase *prog, double waitSec)
+                                       ProgressBase *prog, double waitSec,
+                                       bool pinThread)
     : m_threadnum(threadnum), m_scheduler(scheduler), m_prog(prog),
-      m_waitSec(waitSec) {
+      m_waitSec(waitSec), m_pinThread(pinThread) {
   if (!m_scheduler)
     throw std::invalid_argument(
         "NULL ThreadScheduler passed to ThreadPoolRunnable::ctor()");
@@ -45,6 +103,11 @@ void ThreadPoolRunnable::clearWait() { m_waitSec = 0.0; }
  */
 void ThreadPoolRunnable::run() {
   std::shared_ptr<Task> task;
+  // Share the cores between the pool threads while they run tasks, so that
+  // parallel loops inside the tasks do not oversubscribe the machine.
+  ConcurrentWorkerScope workerScope;
+  if (m_pinThread)
+    pinToCore(m_threadnum);
 
   // If there are no tasks yet, wait up to m_waitSec for them to come up
   while (m_scheduler->empty() && m_waitSec > 0.0) {
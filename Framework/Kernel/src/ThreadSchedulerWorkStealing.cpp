@@ -0,0 +1,168 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2019 ISIS Rutherford Appleton Laboratory UKRI,
+//     NScD Oak Ridge National Laboratory, European Spallation Source
+//     & Institut Laue - Langevin
+// SPDX - License - Identifier: GPL - 3.0 +
+#include "MantidKernel/ThreadSchedulerWorkStealing.h"
+#include "MantidKernel/ThreadPool.h"
+
+#include <algorithm>
+#include <utility>
+
+namespace Mantid {
+namespace Kernel {
+
+namespace {
+/// Add to an atomic value which is updated without a lock
+void atomicAdd(std::atomic<double> &total, const double value) {
+  double current = total.load();
+  while (!total.compare_exchange_weak(current, current + value)) {
+  }
+}
+} // namespace
+
+/** Constructor
+ * @param numQueues :: the number of task queues, which should be the number of
+ * threads of the ThreadPool; default = 0, meaning one per physical core
+ */
+ThreadSchedulerWorkStealing::ThreadSchedulerWorkStealing(size_t numQueues)
+    : ThreadScheduler() {
+  if (numQueues == 0)
+    numQueues = ThreadPool::getNumPhysicalCores();
+  m_queues.reserve(numQueues);
+  for (size_t i = 0; i < numQueues; ++i)
+    m_queues.emplace_back(std::make_unique<WorkerQueue>());
+}
+
+/// Destructor
+ThreadSchedulerWorkStealing::~ThreadSchedulerWorkStealing() { clear(); }
+
+//-------------------------------------------------------------------------------
+/** Add a Task to the next queue in turn.
+ * @param newTask :: Task to add
+ */
+void ThreadSchedulerWorkStealing::push(std::shared_ptr<Task> newTask) {
+  const double cost = newTask->cost();
+  atomicAdd(m_cost, cost);
+  auto &queue = *m_queues[m_nextQueue++ % m_queues.size()];
+  std::lock_guard<std::mutex> lock(queue.lock);
+  queue.tasks.push_back(std::move(newTask));
+  queue.cost = queue.cost + cost;
+  ++m_size;
+}
+
+//-------------------------------------------------------------------------------
+/** Retrieve the next task of the thread's own queue or, if it is empty, steal
+ * one from the queue with the largest remaining cost.
+ * @param threadnum :: ID of the calling thread.
+ * @return the task to run, or NULL if there are none left
+ */
+std::shared_ptr<Task> ThreadSchedulerWorkStealing::pop(size_t threadnum) {
+  auto &ownQueue = *m_queues[threadnum % m_queues.size()];
+  if (auto task = popFrom(ownQueue, true, true))
+    return task;
+
+  // Steal from the queue with the largest remaining cost first. The costs
+  // are copied as other threads keep changing them.
+  std::vector<std::pair<double, WorkerQueue *>> victims;
+  victims.reserve(m_queues.size());
+  for (auto &queue : m_queues) {
+    if (queue.get() != &ownQueue)
+      victims.emplace_back(queue->cost, queue.get());
+  }
+  std::sort(victims.begin(), victims.end(),
+            [](const std::pair<double, WorkerQueue *> &a,
+               const std::pair<double, WorkerQueue *> &b) {
+              return a.first > b.first;
+            });
+  for (const auto &victim : victims) {
+    if (auto task = popFrom(*victim.second, false, true))
+      return task;
+  }
+
+  // Only tasks whose mutex is busy are left: take one anyway, the thread
+  // running it will wait for the mutex
+  if (auto task = popFrom(ownQueue, true, false))
+    return task;
+  for (const auto &victim : victims) {
+    if (auto task = popFrom(*victim.second, false, false))
+      return task;
+  }
+  return nullptr;
+}
+
+//-------------------------------------------------------------------------------
+/** Take a task out of a queue and mark its mutex, if any, as busy.
+ * @param queue :: the queue to take the task from
+ * @param fromFront :: take the oldest task rather than the newest
+ * @param skipBusy :: pass over tasks whose mutex is busy
+ * @return the task, or NULL if there was none
+ */
+std::shared_ptr<Task>
+ThreadSchedulerWorkStealing::popFrom(WorkerQueue &queue, const bool fromFront,
+                                     const bool skipBusy) {
+  std::lock_guard<std::mutex> lock(queue.lock);
+  const size_t numTasks = queue.tasks.size();
+  for (size_t i = 0; i < numTasks; ++i) {
+    const auto it = fromFront ? queue.tasks.begin() + i
+                              : queue.tasks.begin() + (numTasks - 1 - i);
+    auto mutex = (*it)->getMutex();
+    // Check and mark the mutex as busy under the same lock, so that no other
+    // thread can take a task with the same mutex in between
+    std::unique_lock<std::mutex> busyLock(m_busyLock, std::defer_lock);
+    if (mutex) {
+      busyLock.lock();
+      if (skipBusy && m_busyMutexes.find(mutex) != m_busyMutexes.end())
+        continue;
+      m_busyMutexes.insert(mutex);
+    }
+    auto task = std::move(*it);
+    queue.tasks.erase(it);
+    queue.cost = queue.cost - task->cost();
+    --m_size;
+    return task;
+  }
+  return nullptr;
+}
+
+//-----------------------------------------------------------------------------------
+/** Signal to the scheduler that a task is complete, which frees its mutex
+ * and adds its cost to the cost executed.
+ *
+ * @param task :: the Task that was completed.
+ * @param threadnum :: unused argument
+ */
+void ThreadSchedulerWorkStealing::finished(Task *task, size_t threadnum) {
+  UNUSED_ARG(threadnum);
+  atomicAdd(m_costExecuted, task->cost());
+  auto mutex = task->getMutex();
+  if (mutex) {
+    std::lock_guard<std::mutex> lock(m_busyLock);
+    m_busyMutexes.erase(mutex);
+  }
+}
+
+//-------------------------------------------------------------------------------
+/// @return the number of tasks in all queues
+size_t ThreadSchedulerWorkStealing::size() { return m_size; }
+
+//-------------------------------------------------------------------------------
+/// @return true if all queues are empty
+bool ThreadSchedulerWorkStealing::empty() { return m_size == 0; }
+
+//-------------------------------------------------------------------------------
+/// Empty out all queues
+void ThreadSchedulerWorkStealing::clear() {
+  for (auto &queue : m_queues) {
+    std::lock_guard<std::mutex> lock(queue->lock);
+    m_size -= queue->tasks.size();
+    queue->tasks.clear();
+    queue->cost = 0.0;
+  }
+  m_cost = 0;
+  m_costExecuted = 0;
+}
+
+} // namespace Kernel
+} // namespace Mantid
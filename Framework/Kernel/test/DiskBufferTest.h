@@ -79,6 +79,7 @@ public:
 
     for (size_t i = mPos; i < mPos + mMem; i++)
       fakeFile[i] = m_ch;
+    saveOrder += m_ch;
 
     streamMutex.unlock();
     // this is important function call which has to be implemented by any save
@@ -94,15 +95,19 @@ public:
     // function
     this->setLoaded(true);
   }
-  void flushData() const override {}
+  void flushData() const override { ++flushCount; }
 
   static std::string fakeFile;
+  static std::string saveOrder;
   static std::mutex streamMutex;
+  static size_t flushCount;
 };
 
 // Declare the static members here.
 std::string SaveableTesterWithFile::fakeFile;
+std::string SaveableTesterWithFile::saveOrder;
 std::mutex SaveableTesterWithFile::streamMutex;
+size_t SaveableTesterWithFile::flushCount;
 
 //====================================================================================
 class DiskBufferTest : public CxxTest::TestSuite {
@@ -114,6 +119,8 @@ public:
     // Create the ISaveables
     num = 10;
     SaveableTesterWithFile::fakeFile = "";
+    SaveableTesterWithFile::saveOrder = "";
+    SaveableTesterWithFile::flushCount = 0;
     data.clear();
     for (size_t i = 0; i < num; i++)
       data.push_back(
@@ -173,6 +180,20 @@ public:
     TS_ASSERT_EQUALS(SaveableTesterWithFile::fakeFile, "IIHHGGFFEEDDCCBBAA");
   }
 
+  /** The file is flushed after every write dump, even if every object was
+   * busy and nothing was saved */
+  void test_flushes_when_nothing_writable() {
+    // Room for 4 in the write buffer
+    DiskBuffer dbuf(4);
+    for (size_t i = 0; i < 3; i++) {
+      data[i]->setBusy(true);
+      dbuf.toWrite(data[i]);
+    }
+    TS_ASSERT_EQUALS(dbuf.getWriteBufferUsed(), 6);
+    TS_ASSERT_EQUALS(SaveableTesterWithFile::saveOrder, "");
+    TS_ASSERT_EQUALS(SaveableTesterWithFile::flushCount, 1);
+  }
+
   ////--------------------------------------------------------------------------------
   ///** Sorts by file position when writing to a file */
   void test_writesOutInFileOrder() {
@@ -203,6 +224,21 @@ public:
     TS_ASSERT_EQUALS(SaveableTesterWithFile::fakeFile, "  BBCCDDEEFF      JJ");
   }
 
+  //--------------------------------------------------------------------------------
+  /** Blocks already placed on file are saved in order of file position,
+   * whatever order they were added to the buffer in */
+  void test_writesSavedBlocksSortedByFilePosition() {
+    DiskBuffer dbuf(100);
+    for (size_t i : {7, 2, 9, 0, 5}) {
+      data[i]->setDataChanged();
+      dbuf.toWrite(data[i]);
+    }
+    TS_ASSERT_EQUALS(SaveableTesterWithFile::saveOrder, "");
+    dbuf.flushCache();
+    TS_ASSERT_EQUALS(SaveableTesterWithFile::saveOrder, "ACFHJ");
+    TS_ASSERT_EQUALS(dbuf.getWriteBufferUsed(), 0);
+  }
+
   //--------------------------------------------------------------------------------
   /** If a block will get deleted it needs to be taken
    * out of the caches */
@@ -0,0 +1,87 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2019 ISIS Rutherford Appleton Laboratory UKRI,
+//     NScD Oak Ridge National Laboratory, European Spallation Source
+//     & Institut Laue - Langevin
+// SPDX - License - Identifier: GPL - 3.0 +
+#ifndef MANTID_KERNEL_MULTITHREADEDTEST_H_
+#define MANTID_KERNEL_MULTITHREADEDTEST_H_
+
+#include <cxxtest/TestSuite.h>
+
+#include "MantidKernel/MultiThreaded.h"
+
+#include <atomic>
+#include <algorithm>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+using namespace Mantid::Kernel;
+
+class MultiThreadedTest : public CxxTest::TestSuite {
+public:
+  // This pair of boilerplate methods prevent the suite being created statically
+  // This means the constructor isn't called when running other tests
+  static MultiThreadedTest *createSuite() { return new MultiThreadedTest(); }
+  static void destroySuite(MultiThreadedTest *suite) { delete suite; }
+
+  void test_threadBudget_outside_workers_is_max_threads() {
+    TS_ASSERT_EQUALS(threadBudget(), PARALLEL_GET_MAX_THREADS);
+  }
+
+  void test_threadBudget_of_single_worker_is_max_threads() {
+    ConcurrentWorkerScope scope;
+    TS_ASSERT_EQUALS(threadBudget(), PARALLEL_GET_MAX_THREADS);
+  }
+
+  void test_nested_scopes_count_thread_once() {
+    ConcurrentWorkerScope outer;
+    ConcurrentWorkerScope inner;
+    TS_ASSERT_EQUALS(threadBudget(), PARALLEL_GET_MAX_THREADS);
+  }
+
+  void test_threadBudget_is_shared_between_workers() {
+    const int nWorkers = 4;
+    std::mutex mutex;
+    std::condition_variable changed;
+    int registered(0), measured(0);
+    std::vector<int> budgets(nWorkers, 0);
+    std::vector<std::thread> workers;
+    for (int i = 0; i < nWorkers; ++i) {
+      workers.emplace_back([&, i]() {
+        ConcurrentWorkerScope scope;
+        std::unique_lock<std::mutex> lock(mutex);
+        ++registered;
+        changed.notify_all();
+        changed.wait(lock, [&]() { return registered == nWorkers; });
+        budgets[i] = threadBudget();
+        // Stay registered until every worker has measured its budget
+        ++measured;
+        changed.notify_all();
+        changed.wait(lock, [&]() { return measured == nWorkers; });
+      });
+    }
+    for (auto &worker : workers)
+      worker.join();
+
+    const int expected = std::max(1, PARALLEL_GET_MAX_THREADS / nWorkers);
+    for (const auto budget : budgets)
+      TS_ASSERT_EQUALS(budget, expected);
+    // The workers have finished so the calling thread gets everything back
+    TS_ASSERT_EQUALS(threadBudget(), PARALLEL_GET_MAX_THREADS);
+  }
+
+  void test_threadBudget_inside_parallel_region_is_one() {
+    std::atomic<int> maxBudget{0};
+    PARALLEL_FOR_NO_WSP_CHECK()
+    for (int i = 0; i < 100; ++i) {
+      AtomicOp(maxBudget, threadBudget(),
+               [](int a, int b) { return std::max(a, b); });
+    }
+    TS_ASSERT_EQUALS(maxBudget.load(), 1);
+  }
+};
+
+#endif /* MANTID_KERNEL_MULTITHREADEDTEST_H_ */
@@ -9,11 +9,13 @@
 
 #include <cxxtest/TestSuite.h>
 
+#include "MantidKernel/ConfigService.h"
 #include "MantidKernel/FunctionTask.h"
 #include "MantidKernel/ProgressBase.h"
 #include "MantidKernel/ThreadPool.h"
 #include "MantidKernel/ThreadScheduler.h"
 #include "MantidKernel/ThreadSchedulerMutexes.h"
+#include "MantidKernel/ThreadSchedulerWorkStealing.h"
 #include "MantidKernel/Timer.h"
 
 #include <Poco/Thread.h>
@@ -21,6 +23,11 @@
 #include <boost/bind.hpp>
 #include <boost/make_shared.hpp>
 #include <cstdlib>
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#include <unistd.h>
+#endif
 
 using namespace Mantid::Kernel;
 
@@ -145,6 +152,51 @@ public:
 
   void test_Constructor() { ThreadPool p; }
 
+#ifdef __linux__
+  void test_threads_are_pinned_if_configured() {
+    cpu_set_t allowed;
+    CPU_ZERO(&allowed);
+    TS_ASSERT_EQUALS(sched_getaffinity(getpid(), sizeof(cpu_set_t), &allowed),
+                     0);
+
+    const auto pinned = threadAffinities(true);
+    TS_ASSERT_EQUALS(pinned.size(), 8);
+    for (const auto &cpuSet : pinned) {
+      TS_ASSERT_EQUALS(CPU_COUNT(&cpuSet), 1);
+      cpu_set_t inAllowed;
+      CPU_AND(&inAllowed, &cpuSet, &allowed);
+      TS_ASSERT(CPU_EQUAL(&inAllowed, &cpuSet));
+    }
+
+    const auto unpinned = threadAffinities(false);
+    TS_ASSERT_EQUALS(unpinned.size(), 8);
+    for (const auto &cpuSet : unpinned)
+      TS_ASSERT(CPU_EQUAL(&cpuSet, &allowed));
+  }
+
+  /// The cores the threads of a pool may run on while running 8 tasks
+  std::vector<cpu_set_t> threadAffinities(const bool pinThreads) {
+    auto &config = ConfigService::Instance();
+    const auto previous = config.getString("MultiThreaded.PinThreads");
+    config.setString("MultiThreaded.PinThreads", pinThreads ? "1" : "0");
+    std::vector<cpu_set_t> affinities;
+    std::mutex mutex;
+    ThreadPool pool(new ThreadSchedulerFIFO(), 4);
+    for (int i = 0; i < 8; ++i) {
+      pool.schedule(std::make_shared<FunctionTask>([&affinities, &mutex]() {
+        cpu_set_t cpuSet;
+        CPU_ZERO(&cpuSet);
+        pthread_getaffinity_np(pthread_self(), sizeof(cpu_set_t), &cpuSet);
+        std::lock_guard<std::mutex> lock(mutex);
+        affinities.push_back(cpuSet);
+      }));
+    }
+    TS_ASSERT_THROWS_NOTHING(pool.joinAll());
+    config.setString("MultiThreaded.PinThreads", previous);
+    return affinities;
+  }
+#endif
+
   void test_schedule() {
     ThreadPool p;
     TS_ASSERT_EQUALS(threadpooltest_check, 0);
@@ -377,6 +429,10 @@ public:
     do_StressTest_scheduler(new ThreadSchedulerMutexes());
   }
 
+  void test_StressTest_ThreadSchedulerWorkStealing() {
+    do_StressTest_scheduler(new ThreadSchedulerWorkStealing());
+  }
+
   //--------------------------------------------------------------------
   /** Perform a stress test on the given scheduler.
    * This one creates tasks that create new tasks; e.g. 10 tasks each add
@@ -415,6 +471,10 @@ public:
     do_StressTest_TasksThatCreateTasks(new ThreadSchedulerMutexes());
   }
 
+  void test_StressTest_TasksThatCreateTasks_ThreadSchedulerWorkStealing() {
+    do_StressTest_TasksThatCreateTasks(new ThreadSchedulerWorkStealing());
+  }
+
   //=======================================================================================
   /** Task that throws an exception */
   class TaskThatThrows : public Task {
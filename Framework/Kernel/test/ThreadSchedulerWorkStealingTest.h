@@ -0,0 +1,181 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2019 ISIS Rutherford Appleton Laboratory UKRI,
+//     NScD Oak Ridge National Laboratory, European Spallation Source
+//     & Institut Laue - Langevin
+// SPDX - License - Identifier: GPL - 3.0 +
+#ifndef MANTID_KERNEL_THREADSCHEDULERWORKSTEALINGTEST_H_
+#define MANTID_KERNEL_THREADSCHEDULERWORKSTEALINGTEST_H_
+
+#include "MantidKernel/FunctionTask.h"
+#include "MantidKernel/ThreadPool.h"
+#include "MantidKernel/ThreadSchedulerMutexes.h"
+#include "MantidKernel/ThreadSchedulerWorkStealing.h"
+#include <boost/make_shared.hpp>
+#include <cxxtest/TestSuite.h>
+
+#include <atomic>
+
+using namespace Mantid::Kernel;
+
+namespace {
+class TaskWithCost : public Task {
+public:
+  TaskWithCost(double cost, boost::shared_ptr<std::mutex> mutex =
+                                boost::shared_ptr<std::mutex>()) {
+    m_cost = cost;
+    m_mutex = mutex;
+  }
+  void run() override {}
+};
+} // namespace
+
+class ThreadSchedulerWorkStealingTest : public CxxTest::TestSuite {
+public:
+  // This pair of boilerplate methods prevent the suite being created statically
+  // This means the constructor isn't called when running other tests
+  static ThreadSchedulerWorkStealingTest *createSuite() {
+    return new ThreadSchedulerWorkStealingTest();
+  }
+  static void destroySuite(ThreadSchedulerWorkStealingTest *suite) {
+    delete suite;
+  }
+
+  void test_push_distributes_tasks_over_queues() {
+    ThreadSchedulerWorkStealing sc(2);
+    auto task1 = std::make_shared<TaskWithCost>(1.0);
+    auto task2 = std::make_shared<TaskWithCost>(2.0);
+    auto task3 = std::make_shared<TaskWithCost>(3.0);
+    sc.push(task1);
+    sc.push(task2);
+    sc.push(task3);
+    TS_ASSERT_EQUALS(sc.size(), 3);
+    TS_ASSERT_DELTA(sc.totalCost(), 6.0, 1e-12);
+
+    // Each thread runs its own queue in order first
+    TS_ASSERT_EQUALS(sc.pop(1), task2);
+    TS_ASSERT_EQUALS(sc.pop(0), task1);
+    TS_ASSERT_EQUALS(sc.pop(0), task3);
+    TS_ASSERT(sc.empty());
+    TS_ASSERT(!sc.pop(0));
+  }
+
+  void test_steals_newest_task_of_most_costly_queue() {
+    ThreadSchedulerWorkStealing sc(3);
+    auto tasks = {std::make_shared<TaskWithCost>(1.0),
+                  std::make_shared<TaskWithCost>(5.0),
+                  std::make_shared<TaskWithCost>(1.0),
+                  std::make_shared<TaskWithCost>(1.0),
+                  std::make_shared<TaskWithCost>(6.0)};
+    for (const auto &task : tasks)
+      sc.push(task);
+    // Queue 0 holds costs {1, 1}, queue 1 {5, 6} and queue 2 {1}
+    TS_ASSERT_EQUALS(sc.pop(2)->cost(), 1.0);
+    // Queue 2 is empty, so steal the newest task of queue 1
+    TS_ASSERT_EQUALS(sc.pop(2)->cost(), 6.0);
+    TS_ASSERT_EQUALS(sc.pop(1)->cost(), 5.0);
+    TS_ASSERT_EQUALS(sc.size(), 2);
+  }
+
+  void test_passes_over_tasks_with_busy_mutex() {
+    ThreadSchedulerWorkStealing sc(1);
+    auto mutex = boost::make_shared<std::mutex>();
+    auto task1 = std::make_shared<TaskWithCost>(1.0, mutex);
+    auto task2 = std::make_shared<TaskWithCost>(2.0, mutex);
+    auto task3 = std::make_shared<TaskWithCost>(3.0);
+    sc.push(task1);
+    sc.push(task2);
+    sc.push(task3);
+
+    TS_ASSERT_EQUALS(sc.pop(0), task1);
+    // task2 has to wait for task1 to finish
+    TS_ASSERT_EQUALS(sc.pop(0), task3);
+    sc.finished(task1.get(), 0);
+    TS_ASSERT_EQUALS(sc.pop(0), task2);
+  }
+
+  void test_takes_task_with_busy_mutex_when_no_others_are_left() {
+    ThreadSchedulerWorkStealing sc(2);
+    auto mutex = boost::make_shared<std::mutex>();
+    auto task1 = std::make_shared<TaskWithCost>(1.0, mutex);
+    auto task2 = std::make_shared<TaskWithCost>(2.0, mutex);
+    sc.push(task1);
+    sc.push(task2);
+    TS_ASSERT_EQUALS(sc.pop(0), task1);
+    TS_ASSERT_EQUALS(sc.pop(0), task2);
+  }
+
+  void test_clear() {
+    ThreadSchedulerWorkStealing sc(4);
+    for (int i = 0; i < 10; ++i)
+      sc.push(std::make_shared<TaskWithCost>(1.0));
+    sc.clear();
+    TS_ASSERT_EQUALS(sc.size(), 0);
+    TS_ASSERT(sc.empty());
+    TS_ASSERT_EQUALS(sc.totalCost(), 0.0);
+  }
+
+  void test_finished_tasks_add_to_cost_executed() {
+    ThreadSchedulerWorkStealing sc(2);
+    auto task1 = std::make_shared<TaskWithCost>(1.0);
+    auto task2 = std::make_shared<TaskWithCost>(2.0);
+    sc.push(task1);
+    sc.push(task2);
+    TS_ASSERT_EQUALS(sc.totalCostExecuted(), 0.0);
+    sc.finished(sc.pop(0).get(), 0);
+    TS_ASSERT_DELTA(sc.totalCostExecuted(), 1.0, 1e-12);
+    sc.finished(sc.pop(0).get(), 0);
+    TS_ASSERT_DELTA(sc.totalCostExecuted(), 3.0, 1e-12);
+    TS_ASSERT_DELTA(sc.totalCost(), 3.0, 1e-12);
+  }
+
+  void test_thread_pool_runs_all_tasks() {
+    std::atomic<size_t> total{0};
+    ThreadPool pool(new ThreadSchedulerWorkStealing(), 0);
+    const size_t num = 30000;
+    for (size_t i = 1; i <= num; ++i)
+      pool.schedule(std::make_shared<FunctionTask>(
+          [&total, i]() { total += i; }, static_cast<double>(i)));
+    TS_ASSERT_THROWS_NOTHING(pool.joinAll());
+    TS_ASSERT_EQUALS(total, num * (num + 1) / 2);
+  }
+};
+
+//================================================================================================
+/** Runs many tiny tasks through a ThreadPool with each scheduler, to compare
+ * their overhead. */
+class ThreadSchedulerWorkStealingTestPerformance : public CxxTest::TestSuite {
+public:
+  static ThreadSchedulerWorkStealingTestPerformance *createSuite() {
+    return new ThreadSchedulerWorkStealingTestPerformance();
+  }
+  static void destroySuite(ThreadSchedulerWorkStealingTestPerformance *suite) {
+    delete suite;
+  }
+
+  void test_tiny_tasks_FIFO() { runTinyTasks(new ThreadSchedulerFIFO()); }
+
+  void test_tiny_tasks_LargestCost() {
+    runTinyTasks(new ThreadSchedulerLargestCost());
+  }
+
+  void test_tiny_tasks_Mutexes() { runTinyTasks(new ThreadSchedulerMutexes()); }
+
+  void test_tiny_tasks_WorkStealing() {
+    runTinyTasks(new ThreadSchedulerWorkStealing());
+  }
+
+private:
+  void runTinyTasks(ThreadScheduler *scheduler) {
+    std::atomic<size_t> total{0};
+    ThreadPool pool(scheduler, 0);
+    const size_t num = 1000000;
+    for (size_t i = 0; i < num; ++i)
+      pool.schedule(
+          std::make_shared<FunctionTask>([&total]() { ++total; }, 1.0));
+    pool.joinAll();
+    TS_ASSERT_EQUALS(total, num);
+  }
+};
+
+#endif /* MANTID_KERNEL_THREADSCHEDULERWORKSTEALINGTEST_H_ */
@@ -10,6 +10,7 @@
 #include "MantidAPI/DataProcessorAlgorithm.h"
 #include "MantidAPI/IFileLoader.h"
 #include "MantidAPI/IMDEventWorkspace_fwd.h"
+#include "MantidAPI/Progress.h"
 #include "MantidDataObjects/MDEventWorkspace.h"
 #include "MantidKernel/System.h"
 #include <boost/optional.hpp>
@@ -58,6 +59,13 @@ private:
   template <typename MDE, size_t nd>
   void doLoad(typename DataObjects::MDEventWorkspace<MDE, nd>::sptr ws);
 
+  /// Read the events of all boxes in large contiguous blocks
+  template <typename MDE, size_t nd>
+  void loadEventBlocks(API::IBoxControllerIO *const loader,
+                       const std::vector<API::IMDNode *> &boxes,
+                       const std::vector<uint64_t> &eventIndex,
+                       API::Progress &prog);
+
   void loadExperimentInfos(
       boost::shared_ptr<Mantid::API::MultipleExperimentInfos> ws);
 
@@ -8,6 +8,7 @@
 #define MANTID_MDALGORITHMS_SAVEMD_H_
 
 #include "MantidAPI/Algorithm.h"
+#include "MantidAPI/Progress.h"
 #include "MantidDataObjects/MDEventWorkspace.h"
 #include "MantidKernel/System.h"
 
@@ -46,6 +47,13 @@ private:
   template <typename MDE, size_t nd>
   void doSaveEvents(typename DataObjects::MDEventWorkspace<MDE, nd>::sptr ws);
 
+  /// Write the events of all boxes in large contiguous blocks
+  template <typename MDE, size_t nd>
+  void saveEventBlocks(API::IBoxControllerIO *const saver,
+                       const std::vector<API::IMDNode *> &boxes,
+                       const std::vector<uint64_t> &eventIndex,
+                       API::Progress &prog);
+
   /// Save the MDHistoWorkspace.
   void doSaveHisto(Mantid::DataObjects::MDHistoWorkspace_sptr ws);
 
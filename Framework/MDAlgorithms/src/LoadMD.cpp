@@ -28,6 +28,7 @@
 #include "MantidKernel/MDUnit.h"
 #include "MantidKernel/MDUnitFactory.h"
 #include "MantidKernel/Memory.h"
+#include "MantidKernel/MultiThreaded.h"
 #include "MantidKernel/PropertyWithValue.h"
 #include "MantidKernel/System.h"
 #include "MantidMDAlgorithms/SetMDFrame.h"
@@ -591,21 +592,8 @@ void LoadMD::doLoad(typename MDEventWorkspace<MDE, nd>::sptr ws) {
     const std::vector<uint64_t> &BoxEventIndex = FlatBoxTree.getEventIndex();
     prog->setNumSteps(numBoxes);
 
-    for (size_t i = 0; i < numBoxes; i++) {
-      prog->report();
-      auto *box = dynamic_cast<MDBox<MDE, nd> *>(boxTree[i]);
-      if (!box)
-        continue;
-
-      if (BoxEventIndex[2 * i + 1] >
-          0) // Load in memory NOT using the file as the back-end,
-      {
-        boxTree[i]->reserveMemoryForLoad(BoxEventIndex[2 * i + 1]);
-        boxTree[i]->loadAndAddFrom(
-            loader.get(), BoxEventIndex[2 * i],
-            static_cast<size_t>(BoxEventIndex[2 * i + 1]));
-      }
-    }
+    // Load in memory NOT using the file as the back-end
+    loadEventBlocks<MDE, nd>(loader.get(), boxTree, BoxEventIndex, *prog);
     loader->closeFile();
   } else // box structure and metadata only
   {
@@ -628,6 +616,59 @@ void LoadMD::doLoad(typename MDEventWorkspace<MDE, nd>::sptr ws) {
   g_log.debug() << tim << " to finish up.\n";
 }
 
+//----------------------------------------------------------------------------------------------
+/** Read the events of the boxes from an open file. Boxes whose events follow
+ * each other on file are gathered into one block, which is read in one
+ * operation and then converted into the events of each box in parallel.
+ *
+ * @param loader :: the object doing the file IO, with the file opened
+ * @param boxes :: all boxes of the workspace, indexed by box ID
+ * @param eventIndex :: file position and number of events of each box
+ * @param prog :: progress reporter, advanced by one step per box
+ */
+template <typename MDE, size_t nd>
+void LoadMD::loadEventBlocks(API::IBoxControllerIO *const loader,
+                             const std::vector<API::IMDNode *> &boxes,
+                             const std::vector<uint64_t> &eventIndex,
+                             API::Progress &prog) {
+  std::vector<size_t> blockBoxes;
+  std::vector<coord_t> block;
+  size_t firstBox = 0;
+  while (firstBox < boxes.size()) {
+    const size_t nextBox = MDBoxFlatTree::findContiguousBoxes(
+        eventIndex, firstBox, MDBoxFlatTree::MAX_EVENTS_PER_BLOCK, blockBoxes);
+    if (!blockBoxes.empty()) {
+      const uint64_t blockStart = eventIndex[2 * blockBoxes.front()];
+      const size_t lastBox = blockBoxes.back();
+      const uint64_t blockEnd =
+          eventIndex[2 * lastBox] + eventIndex[2 * lastBox + 1];
+      loader->loadBlock(block, blockStart,
+                        static_cast<size_t>(blockEnd - blockStart));
+      const size_t nColumns = block.size() / (blockEnd - blockStart);
+
+      const auto nBlockBoxes = static_cast<int64_t>(blockBoxes.size());
+      PARALLEL_FOR_NO_WSP_CHECK()
+      for (int64_t i = 0; i < nBlockBoxes; ++i) {
+        PARALLEL_START_INTERUPT_REGION
+        const size_t boxIndex = blockBoxes[i];
+        auto *box = dynamic_cast<MDBox<MDE, nd> *>(boxes[boxIndex]);
+        if (box) {
+          const coord_t *first =
+              block.data() + (eventIndex[2 * boxIndex] - blockStart) * nColumns;
+          MDE::dataToEvents(first,
+                            first + eventIndex[2 * boxIndex + 1] * nColumns,
+                            box->getEvents(), false);
+          box->releaseEvents();
+        }
+        PARALLEL_END_INTERUPT_REGION
+      }
+      PARALLEL_CHECK_INTERUPT_REGION
+    }
+    prog.reportIncrement(nextBox - firstBox);
+    firstBox = nextBox;
+  }
+}
+
 /**
  * Load all of the affine matrices from the file, create the
  * appropriate coordinate transform and set those on the workspace.
@@ -12,8 +12,10 @@
 #include "MantidAPI/Run.h"
 #include "MantidAPI/SpectrumInfo.h"
 #include "MantidGeometry/Instrument.h"
+#include "MantidGeometry/Instrument/DetectorInfo.h"
 #include "MantidKernel/CompositeValidator.h"
 #include "MantidKernel/PropertyWithValue.h"
+#include "MantidTypes/SpectrumDefinition.h"
 
 using namespace Mantid;
 using namespace Mantid::API;
@@ -240,6 +242,8 @@ void PreprocessDetectorsToMD::processDetectorsPositions(
   //// Loop over the spectra
   uint32_t liveDetectorsCount(0);
   const auto &spectrumInfo = inputWS->spectrumInfo();
+  const auto &detectorIDs = inputWS->detectorInfo().detectorIDs();
+  const auto geometry = spectrumInfo.geometry();
   for (size_t i = 0; i < nHist; i++) {
     sp2detMap[i] = std::numeric_limits<uint64_t>::quiet_NaN();
     detId[i] = std::numeric_limits<int32_t>::quiet_NaN();
@@ -259,16 +263,16 @@ void PreprocessDetectorsToMD::processDetectorsPositions(
     else if (maskDetector)
       continue;
 
-    const auto &spDet = spectrumInfo.detector(i);
-
-    // calculate the requested values;
+    // calculate the requested values; the ID of a group is that of its first
+    // detector
     sp2detMap[i] = liveDetectorsCount;
-    detId[liveDetectorsCount] = int32_t(spDet.getID());
+    const auto firstDetector = spectrumInfo.spectrumDefinition(i)[0].first;
+    detId[liveDetectorsCount] = int32_t(detectorIDs[firstDetector]);
     detIDMap[liveDetectorsCount] = i;
-    L2[liveDetectorsCount] = spectrumInfo.l2(i);
+    L2[liveDetectorsCount] = geometry.l2[i];
 
-    double polar = spectrumInfo.twoTheta(i);
-    double azim = spDet.getPhi();
+    double polar = geometry.twoTheta[i];
+    double azim = geometry.azimuthal[i];
     TwoTheta[liveDetectorsCount] = polar;
     Azimuthal[liveDetectorsCount] = azim;
 
@@ -289,6 +293,7 @@ void PreprocessDetectorsToMD::processDetectorsPositions(
     // defined;
     if (pEfixedArray) {
       try {
+        const auto &spDet = spectrumInfo.detector(i);
         Geometry::Parameter_sptr par = pmap.getRecursive(&spDet, "eFixed");
         if (par)
           Efi = par->value<double>();
@@ -19,9 +19,11 @@
 #include "MantidDataObjects/MDHistoWorkspace.h"
 #include "MantidKernel/EnabledWhenProperty.h"
 #include "MantidKernel/Matrix.h"
+#include "MantidKernel/MultiThreaded.h"
 #include "MantidKernel/Strings.h"
 #include "MantidKernel/System.h"
 #include <Poco/File.h>
+#include <boost/make_shared.hpp>
 
 using file_holder_type = std::unique_ptr<::NeXus::File>;
 
@@ -82,6 +84,17 @@ void SaveMD::init() {
   setPropertySettings("MakeFileBacked",
                       std::make_unique<EnabledWhenProperty>("UpdateFileBackEnd",
                                                             IS_EQUAL_TO, "0"));
+
+  declareProperty("CompressEventData", false,
+                  "For an MDEventWorkspace saved to a new file that is not "
+                  "file-backed:\n"
+                  "Compress the event data array. The file is smaller but "
+                  "slower to write.");
+  setPropertySettings(
+      "CompressEventData",
+      std::make_unique<EnabledWhenProperty>(
+          EnabledWhenProperty("UpdateFileBackEnd", IS_EQUAL_TO, "0"),
+          EnabledWhenProperty("MakeFileBacked", IS_EQUAL_TO, "0"), AND));
 }
 
 //----------------------------------------------------------------------------------------------
@@ -165,8 +178,8 @@ void SaveMD::doSaveEvents(typename MDEventWorkspace<MDE, nd>::sptr ws) {
     // the boxes file positions are unknown and we need to calculate it.
     BoxFlatStruct.initFlatStructure(ws, filename);
     // create saver class
-    auto Saver = boost::shared_ptr<API::IBoxControllerIO>(
-        new DataObjects::BoxControllerNeXusIO(bc.get()));
+    auto Saver =
+        boost::make_shared<DataObjects::BoxControllerNeXusIO>(bc.get());
     Saver->setDataType(sizeof(coord_t), MDE::getTypeName());
     if (makeFileBackend) {
       // store saver with box controller
@@ -202,17 +215,14 @@ void SaveMD::doSaveEvents(typename MDEventWorkspace<MDE, nd>::sptr ws) {
       Saver->flushData();
     } else // just save data, and finish with it
     {
+      // a file which is written once can afford compressed events
+      Saver->setCompressEvents(getProperty("CompressEventData"));
       Saver->openFile(filename, "w");
       BoxFlatStruct.setBoxesFilePositions(false);
       std::vector<API::IMDNode *> &boxes = BoxFlatStruct.getBoxes();
       std::vector<uint64_t> &eventIndex = BoxFlatStruct.getEventIndex();
       prog->resetNumSteps(boxes.size(), 0.06, 0.90);
-      for (size_t i = 0; i < boxes.size(); i++) {
-        if (eventIndex[2 * i + 1] == 0 || boxes[i]->getIsMasked())
-          continue;
-        boxes[i]->saveAt(Saver.get(), eventIndex[2 * i]);
-        prog->report("Saving Box");
-      }
+      saveEventBlocks<MDE, nd>(Saver.get(), boxes, eventIndex, *prog);
       Saver->closeFile();
     }
   }
@@ -231,6 +241,70 @@ void SaveMD::doSaveEvents(typename MDEventWorkspace<MDE, nd>::sptr ws) {
   ws->setFileNeedsUpdating(false);
 }
 
+//----------------------------------------------------------------------------------------------
+/** Write the events of the boxes to an open file. Boxes whose events follow
+ * each other on file are gathered into one block: their events are converted
+ * to the file layout in parallel and the block is written in one operation.
+ * Masked boxes are not written.
+ *
+ * @param saver :: the object doing the file IO, with the file opened
+ * @param boxes :: all boxes of the workspace, indexed by box ID
+ * @param eventIndex :: file position and number of events of each box
+ * @param prog :: progress reporter, advanced by one step per box
+ */
+template <typename MDE, size_t nd>
+void SaveMD::saveEventBlocks(API::IBoxControllerIO *const saver,
+                             const std::vector<API::IMDNode *> &boxes,
+                             const std::vector<uint64_t> &eventIndex,
+                             API::Progress &prog) {
+  // the events of masked boxes are left out of the file
+  std::vector<uint64_t> eventsToWrite(eventIndex);
+  for (size_t i = 0; i < boxes.size(); i++) {
+    if (boxes[i]->getIsMasked())
+      eventsToWrite[2 * i + 1] = 0;
+  }
+
+  std::vector<size_t> blockBoxes;
+  std::vector<coord_t> block;
+  size_t firstBox = 0;
+  while (firstBox < boxes.size()) {
+    const size_t nextBox = MDBoxFlatTree::findContiguousBoxes(
+        eventsToWrite, firstBox, MDBoxFlatTree::MAX_EVENTS_PER_BLOCK,
+        blockBoxes);
+    const auto nBlockBoxes = static_cast<int64_t>(blockBoxes.size());
+
+    std::vector<std::vector<coord_t>> tables(blockBoxes.size());
+    PARALLEL_FOR_NO_WSP_CHECK()
+    for (int64_t i = 0; i < nBlockBoxes; ++i) {
+      PARALLEL_START_INTERUPT_REGION
+      auto *box = dynamic_cast<MDBox<MDE, nd> *>(boxes[blockBoxes[i]]);
+      if (!box)
+        throw std::runtime_error("Found events in a box which is not MDBox");
+      size_t nColumns;
+      double totalSignal, totalErrSq;
+      MDE::eventsToData(box->getConstEvents(), tables[i], nColumns,
+                        totalSignal, totalErrSq);
+      box->releaseEvents();
+      // as MDBox::saveAt does, refresh the box cache from its events
+      box->setSignal(static_cast<signal_t>(totalSignal));
+      box->setErrorSquared(static_cast<signal_t>(totalErrSq));
+      PARALLEL_END_INTERUPT_REGION
+    }
+    PARALLEL_CHECK_INTERUPT_REGION
+
+    if (!blockBoxes.empty()) {
+      block.clear();
+      for (auto &table : tables) {
+        block.insert(block.end(), table.begin(), table.end());
+        std::vector<coord_t>().swap(table);
+      }
+      saver->saveBlock(block, eventsToWrite[2 * blockBoxes.front()]);
+    }
+    prog.reportIncrement(nextBox - firstBox, "Saving Box");
+    firstBox = nextBox;
+  }
+}
+
 //----------------------------------------------------------------------------------------------
 /** Save a MDHistoWorkspace to a .nxs file
  *
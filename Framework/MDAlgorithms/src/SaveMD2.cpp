@@ -70,6 +70,17 @@ void SaveMD2::init() {
   setPropertySettings("MakeFileBacked",
                       std::make_unique<EnabledWhenProperty>("UpdateFileBackEnd",
                                                             IS_EQUAL_TO, "0"));
+
+  declareProperty("CompressEventData", false,
+                  "For an MDEventWorkspace saved to a new file that is not "
+                  "file-backed:\n"
+                  "Compress the event data array. The file is smaller but "
+                  "slower to write.");
+  setPropertySettings(
+      "CompressEventData",
+      std::make_unique<EnabledWhenProperty>(
+          EnabledWhenProperty("UpdateFileBackEnd", IS_EQUAL_TO, "0"),
+          EnabledWhenProperty("MakeFileBacked", IS_EQUAL_TO, "0"), AND));
 }
 
 //----------------------------------------------------------------------------------------------
@@ -216,6 +227,8 @@ void SaveMD2::exec() {
                                 getProperty("UpdateFileBackEnd"));
     saveMDv1->setProperty<bool>("MakeFileBacked",
                                 getProperty("MakeFileBacked"));
+    saveMDv1->setProperty<bool>("CompressEventData",
+                                getProperty("CompressEventData"));
     saveMDv1->execute();
   } else if (histoWS) {
     this->doSaveHisto(histoWS);
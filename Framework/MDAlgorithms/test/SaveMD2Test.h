@@ -20,6 +20,7 @@
 #include <cxxtest/TestSuite.h>
 
 #include <Poco/File.h>
+#include <hdf5.h>
 
 using namespace Mantid::API;
 using namespace Mantid::DataObjects;
@@ -281,6 +282,55 @@ public:
     }
   }
 
+  void test_saveCompressedEventData_roundTrip() {
+    const std::string inputWSName("SaveMD2Test_compressedInputWS");
+    MDEventsTestHelper::makeAnyMDEW<MDLeanEvent<2>, 2>(10, 0., 20., 3,
+                                                       inputWSName);
+
+    const std::string saveFilename = "SaveMD2Test_compressed.nxs";
+    SaveMD2 saveAlg;
+    TS_ASSERT_THROWS_NOTHING(saveAlg.initialize())
+    TS_ASSERT(saveAlg.isInitialized())
+    TS_ASSERT_THROWS_NOTHING(
+        saveAlg.setPropertyValue("InputWorkspace", inputWSName));
+    TS_ASSERT_THROWS_NOTHING(
+        saveAlg.setPropertyValue("Filename", saveFilename));
+    TS_ASSERT_THROWS_NOTHING(saveAlg.setProperty("CompressEventData", true));
+    saveAlg.execute();
+    TS_ASSERT(saveAlg.isExecuted());
+    const std::string this_filename = saveAlg.getProperty("Filename");
+    assertEventDataCompressed(this_filename);
+
+    const std::string loadedWSName("SaveMD2Test_compressedLoadedWS");
+    LoadMD loadAlg;
+    TS_ASSERT_THROWS_NOTHING(loadAlg.initialize())
+    TS_ASSERT(loadAlg.isInitialized())
+    TS_ASSERT_THROWS_NOTHING(
+        loadAlg.setPropertyValue("Filename", saveFilename));
+    TS_ASSERT_THROWS_NOTHING(loadAlg.setProperty("FileBackEnd", false));
+    TS_ASSERT_THROWS_NOTHING(
+        loadAlg.setPropertyValue("OutputWorkspace", loadedWSName));
+    TS_ASSERT_THROWS_NOTHING(loadAlg.execute(););
+    TS_ASSERT(loadAlg.isExecuted());
+
+    IMDEventWorkspace_sptr loaded;
+    TS_ASSERT_THROWS_NOTHING(
+        loaded = AnalysisDataService::Instance().retrieveWS<IMDEventWorkspace>(
+            loadedWSName));
+    TS_ASSERT(loaded);
+    if (loaded) {
+      TS_ASSERT_EQUALS(loaded->getNPoints(), 300);
+      loaded->refreshCache();
+      TS_ASSERT_DELTA(loaded->getBox()->getSignal(), 300.0, 1e-6);
+    }
+
+    AnalysisDataService::Instance().remove(inputWSName);
+    AnalysisDataService::Instance().remove(loadedWSName);
+    if (Poco::File(this_filename).exists()) {
+      Poco::File(this_filename).remove();
+    }
+  }
+
   /** Run SaveMD with the MDHistoWorkspace */
   void doTestHisto(MDHistoWorkspace_sptr ws) {
     std::string filename = "SaveMD2TestHisto.nxs";
@@ -304,6 +354,35 @@ public:
         2.5, 2, 10, 10.0, 3.5, "histo2", 4.5);
     doTestHisto(ws);
   }
+
+private:
+  /// Check that the event data array in the file is chunked and compressed.
+  /// NeXus uses the HDF5 deflate filter for its LZW compression.
+  void assertEventDataCompressed(const std::string &filename) {
+    const auto fid = H5Fopen(filename.c_str(), H5F_ACC_RDONLY, H5P_DEFAULT);
+    TS_ASSERT_LESS_THAN(0, fid);
+    if (fid < 0)
+      return;
+    const auto did =
+        H5Dopen(fid, "/MDEventWorkspace/event_data/event_data", H5P_DEFAULT);
+    TS_ASSERT_LESS_THAN(0, did);
+    if (did >= 0) {
+      const auto plist = H5Dget_create_plist(did);
+      TS_ASSERT_EQUALS(H5Pget_layout(plist), H5D_CHUNKED);
+      bool deflated = false;
+      for (int i = 0; i < H5Pget_nfilters(plist); ++i) {
+        unsigned int flags = 0, filterConfig = 0;
+        size_t numValues = 0;
+        if (H5Pget_filter2(plist, i, &flags, &numValues, nullptr, 0, nullptr,
+                           &filterConfig) == H5Z_FILTER_DEFLATE)
+          deflated = true;
+      }
+      TS_ASSERT(deflated);
+      H5Pclose(plist);
+      H5Dclose(did);
+    }
+    H5Fclose(fid);
+  }
 };
 
 class SaveMD2TestPerformance : public CxxTest::TestSuite {
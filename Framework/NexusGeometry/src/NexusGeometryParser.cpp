@@ -12,6 +12,8 @@
 #include "MantidGeometry/Rendering/ShapeInfo.h"
 #include "MantidKernel/ChecksumHelper.h"
 #include "MantidKernel/EigenConversionHelpers.h"
+#include "MantidKernel/MultiThreaded.h"
+#include "MantidKernel/Tolerance.h"
 #include "MantidNexusGeometry/NexusGeometryDefinitions.h"
 
 #include "MantidNexusGeometry/Hdf5Version.h"
@@ -24,6 +26,8 @@
 #include <boost/algorithm/string.hpp>
 #include <boost/optional.hpp>
 #include <boost/regex.hpp>
+#include <exception>
+#include <map>
 #include <numeric>
 #include <tuple>
 #include <type_traits>
@@ -100,6 +104,23 @@ std::vector<ValueType> extractVector(const DataSet &data) {
   return values;
 }
 
+/// Whether two pixel meshes, each relative to its own centre, are the same
+bool isSameMesh(const std::vector<Eigen::Vector3d> &lhsVerts,
+                const std::vector<uint32_t> &lhsIndices,
+                const std::vector<uint32_t> &lhsWinding,
+                const std::vector<Eigen::Vector3d> &rhsVerts,
+                const std::vector<uint32_t> &rhsIndices,
+                const std::vector<uint32_t> &rhsWinding) {
+  if (lhsVerts.size() != rhsVerts.size() || lhsIndices != rhsIndices ||
+      lhsWinding != rhsWinding)
+    return false;
+  for (size_t i = 0; i < lhsVerts.size(); ++i) {
+    if ((lhsVerts[i] - rhsVerts[i]).cwiseAbs().maxCoeff() > Kernel::Tolerance)
+      return false;
+  }
+  return true;
+}
+
 /**
  * Parser as local class. Makes logging (side-effect) easier.
  */
@@ -546,23 +567,69 @@ private:
                        vertsPerFace, detFaceVerts, detFaceIndices,
                        detWindingOrder, detIds);
 
-    for (size_t i = 0; i < numDets; ++i) {
+    const auto numPixels = static_cast<int64_t>(numDets);
+    std::vector<Eigen::Vector3d> centres(numDets);
+    PARALLEL_FOR_NO_WSP_CHECK()
+    for (int64_t i = 0; i < numPixels; ++i) {
       auto &detVerts = detFaceVerts[i];
-      const auto &detIndices = detFaceIndices[i];
-      const auto &detWinding = detWindingOrder[i];
       // Calculate polygon centre
-      auto centre = std::accumulate(detVerts.begin() + 1, detVerts.end(),
-                                    detVerts.front()) /
-                    detVerts.size();
+      const Eigen::Vector3d centre =
+          std::accumulate(detVerts.begin() + 1, detVerts.end(),
+                          detVerts.front()) /
+          static_cast<double>(detVerts.size());
 
       // translate shape to origin for shape coordinates.
       std::for_each(detVerts.begin(), detVerts.end(),
                     [&centre](Eigen::Vector3d &val) { val -= centre; });
+      centres[i] = centre;
+    }
 
-      auto shape = NexusShapeFactory::createFromOFFMesh(detIndices, detWinding,
-                                                        detVerts);
+    // The pixels of a bank are usually identical so one shape is shared by
+    // all pixels with the same mesh. Only a bounded number of distinct meshes
+    // of each size are compared against to keep irregular banks linear.
+    const size_t maxCandidates = 16;
+    std::map<std::pair<size_t, size_t>, std::vector<size_t>> candidates;
+    std::vector<size_t> shapeIndices(numDets);
+    for (size_t i = 0; i < numDets; ++i) {
+      auto &sameSize =
+          candidates[{detFaceVerts[i].size(), detFaceIndices[i].size()}];
+      const auto match =
+          std::find_if(sameSize.cbegin(), sameSize.cend(), [&](size_t j) {
+            return isSameMesh(detFaceVerts[i], detFaceIndices[i],
+                              detWindingOrder[i], detFaceVerts[j],
+                              detFaceIndices[j], detWindingOrder[j]);
+          });
+      if (match != sameSize.cend()) {
+        shapeIndices[i] = *match;
+      } else {
+        shapeIndices[i] = i;
+        if (sameSize.size() < maxCandidates)
+          sameSize.push_back(i);
+      }
+    }
+
+    std::vector<boost::shared_ptr<const Geometry::IObject>> shapes(numDets);
+    std::exception_ptr shapeError;
+    PARALLEL_FOR_NO_WSP_CHECK()
+    for (int64_t i = 0; i < numPixels; ++i) {
+      if (shapeIndices[i] != static_cast<size_t>(i))
+        continue;
+      try {
+        shapes[i] = NexusShapeFactory::createFromOFFMesh(
+            detFaceIndices[i], detWindingOrder[i], detFaceVerts[i]);
+      } catch (...) {
+        PARALLEL_CRITICAL(parseNexusMeshShapes) {
+          if (!shapeError)
+            shapeError = std::current_exception();
+        }
+      }
+    }
+    if (shapeError)
+      std::rethrow_exception(shapeError);
+
+    for (size_t i = 0; i < numDets; ++i) {
       builder.addDetectorToLastBank(name + "_" + std::to_string(i), detIds[i],
-                                    centre, std::move(shape));
+                                    centres[i], shapes[shapeIndices[i]]);
     }
   }
 
@@ -9,6 +9,7 @@
 
 #include <cxxtest/TestSuite.h>
 
+#include "FileResource.h"
 #include "MantidGeometry/Instrument.h"
 #include "MantidGeometry/Instrument/ComponentInfo.h"
 #include "MantidGeometry/Instrument/DetectorInfo.h"
@@ -19,10 +20,12 @@
 #include "MantidKernel/ConfigService.h"
 #include "MantidKernel/EigenConversionHelpers.h"
 #include "MantidKernel/WarningSuppressions.h"
+#include "MantidNexusGeometry/NexusGeometryDefinitions.h"
 #include "MantidNexusGeometry/NexusGeometryParser.h"
 
 #include <H5Cpp.h>
 #include <Poco/Glob.h>
+#include <array>
 #include <chrono>
 #include <gmock/gmock.h>
 #include <string>
@@ -44,6 +47,78 @@ extractBeamline(const Mantid::Geometry::Instrument &instrument) {
   return {std::move(std::get<0>(beamline)), std::move(std::get<1>(beamline))};
 }
 
+H5::Group createNXGroup(H5::Group &parent, const std::string &name,
+                        const std::string &nxClass) {
+  auto group = parent.createGroup(name);
+  H5::StrType type(H5::PredType::C_S1, nxClass.size());
+  group.createAttribute(NX_CLASS, type, H5::DataSpace(H5S_SCALAR))
+      .write(type, nxClass);
+  return group;
+}
+
+template <typename T>
+void writeDataset(H5::Group &group, const std::string &name,
+                  const std::vector<T> &values, const H5::PredType &type) {
+  const hsize_t size = values.size();
+  group.createDataSet(name, type, H5::DataSpace(1, &size))
+      .write(values.data(), type);
+}
+
+/// Write an instrument with one bank of cube shaped pixels described by a
+/// single mesh. The first two pixels are the same cube at different
+/// positions, the third one is a smaller cube.
+void writeMeshPixelFile(const std::string &filename) {
+  H5::H5File file(filename, H5F_ACC_TRUNC);
+  auto root = file.openGroup("/");
+  auto entry = createNXGroup(root, "entry", NX_ENTRY);
+  auto instrument = createNXGroup(entry, "instrument", NX_INSTRUMENT);
+  const std::string instrumentName = "MeshPixels";
+  H5::StrType nameType(H5::PredType::C_S1, instrumentName.size());
+  instrument.createDataSet(NAME, nameType, H5::DataSpace(H5S_SCALAR))
+      .write(instrumentName, nameType);
+  createNXGroup(instrument, "source", NX_SOURCE);
+  createNXGroup(entry, "sample", NX_SAMPLE);
+  auto detector = createNXGroup(instrument, "detector", NX_DETECTOR);
+  writeDataset(detector, DETECTOR_IDS, std::vector<int32_t>{1, 2, 3},
+               H5::PredType::NATIVE_INT32);
+
+  const std::array<Kernel::V3D, 8> cubeCorners{
+      {{0, 0, 0}, {1, 0, 0}, {1, 1, 0}, {0, 1, 0}, {0, 0, 1}, {1, 0, 1},
+       {1, 1, 1}, {0, 1, 1}}};
+  const std::array<std::array<int32_t, 4>, 6> cubeFaces{{{{0, 3, 2, 1}},
+                                                         {{4, 5, 6, 7}},
+                                                         {{0, 1, 5, 4}},
+                                                         {{2, 3, 7, 6}},
+                                                         {{0, 4, 7, 3}},
+                                                         {{1, 2, 6, 5}}}};
+  const std::array<std::pair<Kernel::V3D, double>, 3> cubes{
+      {{{0, 0, 0}, 1.0}, {{2, 0, 0}, 1.0}, {{4, 0, 0}, 0.5}}};
+  std::vector<float> vertices;
+  std::vector<int32_t> faces, windingOrder, detectorFaces;
+  for (size_t pixel = 0; pixel < cubes.size(); ++pixel) {
+    const auto firstVertex = static_cast<int32_t>(vertices.size() / 3);
+    for (const auto &corner : cubeCorners) {
+      const auto vertex = cubes[pixel].first + corner * cubes[pixel].second;
+      for (size_t i = 0; i < 3; ++i)
+        vertices.push_back(static_cast<float>(vertex[i]));
+    }
+    for (const auto &face : cubeFaces) {
+      detectorFaces.push_back(static_cast<int32_t>(faces.size()));
+      detectorFaces.push_back(static_cast<int32_t>(pixel + 1));
+      faces.push_back(static_cast<int32_t>(windingOrder.size()));
+      for (const auto index : face)
+        windingOrder.push_back(firstVertex + index);
+    }
+  }
+  auto shape = createNXGroup(detector, DETECTOR_SHAPE, NX_OFF);
+  writeDataset(shape, "vertices", vertices, H5::PredType::NATIVE_FLOAT);
+  writeDataset(shape, "faces", faces, H5::PredType::NATIVE_INT32);
+  writeDataset(shape, "winding_order", windingOrder,
+               H5::PredType::NATIVE_INT32);
+  writeDataset(shape, "detector_faces", detectorFaces,
+               H5::PredType::NATIVE_INT32);
+}
+
 class MockLogger : public NexusGeometry::Logger {
 public:
   GNU_DIAG_OFF_SUGGEST_OVERRIDE
@@ -215,6 +290,31 @@ public:
     TS_ASSERT_DELTA(shapeBB.yMax() - shapeBB.yMin(), 2.0, 1e-9);
     TS_ASSERT_DELTA(shapeBB.zMax() - shapeBB.zMin(), 2.0, 1e-9);
   }
+
+  void test_identical_mesh_pixels_share_shape() {
+    ScopedFileHandle fileResource("mesh_pixels_test_file.hdf5");
+    writeMeshPixelFile(fileResource.fullPath());
+    auto instrument = NexusGeometryParser::createInstrument(
+        fileResource.fullPath(), std::make_unique<MockLogger>());
+    auto beamline = extractBeamline(*instrument);
+    auto componentInfo = std::move(beamline.first);
+    auto detectorInfo = std::move(beamline.second);
+    TS_ASSERT_EQUALS(detectorInfo->size(), 3);
+
+    // Pixels with the same mesh share one shape, others have their own
+    TS_ASSERT_EQUALS(&componentInfo->shape(0), &componentInfo->shape(1));
+    TS_ASSERT_DIFFERS(&componentInfo->shape(0), &componentInfo->shape(2));
+    const auto unitBox = componentInfo->shape(0).getBoundingBox();
+    TS_ASSERT_DELTA(unitBox.xMax() - unitBox.xMin(), 1.0, 1e-6);
+    const auto smallBox = componentInfo->shape(2).getBoundingBox();
+    TS_ASSERT_DELTA(smallBox.xMax() - smallBox.xMin(), 0.5, 1e-6);
+
+    // Each pixel is at the centre of its cube
+    TS_ASSERT_EQUALS(detectorInfo->position(0), Kernel::V3D(0.5, 0.5, 0.5));
+    TS_ASSERT_EQUALS(detectorInfo->position(1), Kernel::V3D(2.5, 0.5, 0.5));
+    TS_ASSERT_EQUALS(detectorInfo->position(2),
+                     Kernel::V3D(4.25, 0.25, 0.25));
+  }
 };
 
 class NexusGeometryParserTestPerformance : public CxxTest::TestSuite {
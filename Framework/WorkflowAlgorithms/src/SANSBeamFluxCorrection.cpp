@@ -66,42 +66,43 @@ void SANSBeamFluxCorrection::exec() {
   progress.report("Loading reference data");
   MatrixWorkspace_sptr fluxRefWS = loadReference();
 
-  // Rebin the reference and monitor data to the sample data workspace
-  progress.report("Rebinning reference data");
-  IAlgorithm_sptr convAlg = createChildAlgorithm("ConvertToHistogram");
+  // Rebin the reference and monitor data to the sample data workspace. The
+  // reference and monitor branches are independent and run concurrently.
+  progress.report("Rebinning reference and monitor data");
+  auto convAlg = createChildAlgorithm("ConvertToHistogram");
   convAlg->setProperty("InputWorkspace", fluxRefWS);
-  convAlg->executeAsChildAlg();
-  fluxRefWS = convAlg->getProperty("OutputWorkspace");
-
-  IAlgorithm_sptr rebinAlg = createChildAlgorithm("RebinToWorkspace");
-  rebinAlg->setProperty("WorkspaceToRebin", fluxRefWS);
-  rebinAlg->setProperty("WorkspaceToMatch", inputWS);
-  rebinAlg->executeAsChildAlg();
-  MatrixWorkspace_sptr scaledfluxRefWS =
-      rebinAlg->getProperty("OutputWorkspace");
-
-  progress.report("Rebinning monitor data");
-  rebinAlg = createChildAlgorithm("RebinToWorkspace");
-  rebinAlg->setProperty("WorkspaceToRebin", monitorWS);
-  rebinAlg->setProperty("WorkspaceToMatch", inputWS);
-  rebinAlg->executeAsChildAlg();
-  monitorWS = rebinAlg->getProperty("OutputWorkspace");
+  const auto convStep = addChildStep(convAlg);
+
+  auto rebinRefAlg = createChildAlgorithm("RebinToWorkspace");
+  rebinRefAlg->setProperty("WorkspaceToMatch", inputWS);
+  const auto rebinRefStep = addChildStep(rebinRefAlg);
+  connectChildSteps(convStep, "OutputWorkspace", rebinRefStep,
+                    "WorkspaceToRebin");
+
+  auto rebinMonAlg = createChildAlgorithm("RebinToWorkspace");
+  rebinMonAlg->setProperty("WorkspaceToRebin", monitorWS);
+  rebinMonAlg->setProperty("WorkspaceToMatch", inputWS);
+  const auto rebinMonStep = addChildStep(rebinMonAlg);
 
-  progress.report("Correcting input data");
   // I = I_0 / Phi_sample
   // Phi_sample = M_sample * [Phi_ref/M_ref]
-  // where [Phi_ref/M_ref] is the fluxRefWS workspace
-  IAlgorithm_sptr divideAlg = createChildAlgorithm("Divide");
-  divideAlg->setProperty("LHSWorkspace", inputWS);
-  divideAlg->setProperty("RHSWorkspace", monitorWS);
-  divideAlg->executeAsChildAlg();
-  MatrixWorkspace_sptr outputWS = divideAlg->getProperty("OutputWorkspace");
-
-  divideAlg = createChildAlgorithm("Divide");
-  divideAlg->setProperty("LHSWorkspace", outputWS);
-  divideAlg->setProperty("RHSWorkspace", scaledfluxRefWS);
-  divideAlg->executeAsChildAlg();
-  outputWS = divideAlg->getProperty("OutputWorkspace");
+  // where [Phi_ref/M_ref] is the rebinned reference workspace
+  auto divideMonAlg = createChildAlgorithm("Divide");
+  divideMonAlg->setProperty("LHSWorkspace", inputWS);
+  const auto divideMonStep = addChildStep(divideMonAlg);
+  connectChildSteps(rebinMonStep, "OutputWorkspace", divideMonStep,
+                    "RHSWorkspace");
+
+  auto divideRefAlg = createChildAlgorithm("Divide");
+  const auto divideRefStep = addChildStep(divideRefAlg);
+  connectChildSteps(divideMonStep, "OutputWorkspace", divideRefStep,
+                    "LHSWorkspace");
+  connectChildSteps(rebinRefStep, "OutputWorkspace", divideRefStep,
+                    "RHSWorkspace");
+
+  progress.report("Correcting input data");
+  executeChildSteps();
+  MatrixWorkspace_sptr outputWS = divideRefAlg->getProperty("OutputWorkspace");
   setProperty("OutputWorkspace", outputWS);
   setProperty("OutputMessage", "Flux correction applied\n" + m_output_message);
 }